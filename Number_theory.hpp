@@ -6,7 +6,17 @@
 #include <cmath>
 #include <cassert>
 #include <numeric>
-#include "euclidean.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <variant>
+#include "discrete_math/euclidean_algorithm/euclidean.hpp"
+#include "big_integer.hpp"
 namespace number_theory
 {
     // Function to check if a vector of numbers are pairwise coprime.
@@ -24,10 +34,10 @@ namespace number_theory
     /*finds num ^ exponent modulo mod, ensure that it is of O(log(exponent))
      * complexity*/
     template <std::size_t mod>
-    inline auto modular_pow(std::integral auto num, std::size_t exponent)
+    constexpr auto modular_pow(std::integral auto num, std::size_t exponent)
     {
         using T = std::remove_cvref_t<decltype(num)>;
-        if (mod == 1) return 0;
+        if (mod == 1) return T{ 0 };
         T result{ 1 };
         num %= mod;
         while (exponent > 0) {
@@ -42,7 +52,7 @@ namespace number_theory
      * num * inv = 1 modulo mod*/
      // extended_gcd?
     template <std::size_t mod>
-    inline auto modular_inverse(std::integral auto num) {
+    constexpr auto modular_inverse(std::integral auto num) {
         auto [result, _] = algorithms::gcd_extended(num, mod);
         auto [coefficients, gcd] = result;
         auto [x, _unused] = coefficients;
@@ -60,6 +70,201 @@ namespace number_theory
         }
         return (b * number_theory::modular_inverse<mod>(a) % mod);
     }
+    /*reductions modulo a 64-bit number fixed at run time, both keep their
+     * numbers in a form of their own: to() enters it and from() leaves it*/
+    namespace modular_detail {
+        using u128 = unsigned __int128;
+
+        /*base^exponent for bases already in the form of the reduction*/
+        template <typename Reduction>
+        inline auto pow(const Reduction& r, std::uint64_t base, std::uint64_t exponent) {
+            std::uint64_t result = r.one();
+            while (exponent > 0) {
+                if (exponent % 2 == 1) result = r.multiply(result, base);
+                base = r.multiply(base, base);
+                exponent /= 2;
+            }
+            return result;
+        }
+
+        /*arithmetic modulo an odd n on numbers in Montgomery form x * 2^64 mod n,
+         * a product costs two multiplications instead of a 128-bit division*/
+        struct montgomery {
+            std::uint64_t n;
+            std::uint64_t n_inverse;  // n * n_inverse = 1 modulo 2^64
+            std::uint64_t r_squared;  // 2^128 modulo n
+
+            explicit montgomery(std::uint64_t modulus) : n{ modulus }, n_inverse{ modulus } {
+                // every Newton step doubles the number of correct low bits
+                for (int i = 0; i < 5; ++i) n_inverse *= 2 - n * n_inverse;
+                const std::uint64_t r = (0 - n) % n;
+                r_squared = static_cast<std::uint64_t>(static_cast<u128>(r) * r % n);
+            }
+            /*t * 2^-64 modulo n for t < n * 2^64*/
+            auto reduce(u128 t) const -> std::uint64_t {
+                const std::uint64_t m = static_cast<std::uint64_t>(t) * n_inverse;
+                const std::uint64_t high = static_cast<std::uint64_t>(t >> 64);
+                const std::uint64_t mn = static_cast<std::uint64_t>((static_cast<u128>(m) * n) >> 64);
+                return high >= mn ? high - mn : high + (n - mn);
+            }
+            auto multiply(std::uint64_t a, std::uint64_t b) const -> std::uint64_t {
+                return reduce(static_cast<u128>(a) * b);
+            }
+            auto add(std::uint64_t a, std::uint64_t b) const -> std::uint64_t {
+                return a >= n - b ? a - (n - b) : a + b;
+            }
+            // any a < 2^64 works since a * r_squared < n * 2^64
+            auto to(std::uint64_t a) const -> std::uint64_t { return multiply(a, r_squared); }
+            auto from(std::uint64_t a) const -> std::uint64_t { return reduce(a); }
+            auto one() const -> std::uint64_t { return to(1); }
+            auto pow(std::uint64_t base, std::uint64_t exponent) const -> std::uint64_t {
+                return modular_detail::pow(*this, base, exponent);
+            }
+        };
+
+        /*arithmetic modulo any n, x mod n = x - q n where q is the high half of
+         * x * floor((2^128 - 1) / n) and is off by at most a few units. Products
+         * that fit in 64 bits, always the case for n < 2^32, need only the
+         * 64-bit estimate*/
+        struct barrett {
+            std::uint64_t n;
+            u128 mu;
+            std::uint64_t mu_64;
+
+            explicit barrett(std::uint64_t modulus)
+                : n{ modulus }, mu{ ~u128{ 0 } / modulus }, mu_64{ ~std::uint64_t{ 0 } / modulus } {}
+            auto reduce(u128 x) const -> std::uint64_t {
+                if ((x >> 64) == 0) {
+                    const std::uint64_t x0 = static_cast<std::uint64_t>(x);
+                    const std::uint64_t q = static_cast<std::uint64_t>((static_cast<u128>(x0) * mu_64) >> 64);
+                    std::uint64_t r = x0 - q * n;
+                    while (r >= n) r -= n;
+                    return r;
+                }
+                const u128 x0 = static_cast<std::uint64_t>(x);
+                const u128 x1 = x >> 64;
+                const u128 mu0 = static_cast<std::uint64_t>(mu);
+                const u128 mu1 = mu >> 64;
+                const u128 middle = ((x0 * mu0) >> 64) + static_cast<std::uint64_t>(x0 * mu1) +
+                    static_cast<std::uint64_t>(x1 * mu0);
+                const u128 q = x1 * mu1 + ((x0 * mu1) >> 64) + ((x1 * mu0) >> 64) + (middle >> 64);
+                u128 r = x - q * n;
+                while (r >= n) r -= n;
+                return static_cast<std::uint64_t>(r);
+            }
+            auto multiply(std::uint64_t a, std::uint64_t b) const -> std::uint64_t {
+                return reduce(static_cast<u128>(a) * b);
+            }
+            auto to(std::uint64_t a) const -> std::uint64_t { return a < n ? a : reduce(a); }
+            auto from(std::uint64_t a) const -> std::uint64_t { return a; }
+            auto one() const -> std::uint64_t { return n == 1 ? 0 : 1; }
+        };
+    }
+    /*arithmetic modulo a modulus known only at run time, unlike modular_pow
+     * and modular_inverse which need it as a template parameter. Odd moduli
+     * use Montgomery reduction and even ones Barrett reduction, both set up
+     * once, so no operation divides in hardware except inverse, which runs
+     * the extended Euclidean algorithm. Values are residues in [0, modulus)*/
+    class runtime_modulus {
+    public:
+        explicit runtime_modulus(std::uint64_t modulus) : reduction_{ make_reduction(modulus) } {}
+
+        auto modulus() const -> std::uint64_t {
+            return std::visit([](const auto& r) { return r.n; }, reduction_);
+        }
+        auto multiply(std::uint64_t a, std::uint64_t b) const -> std::uint64_t {
+            return std::visit([&](const auto& r) { return r.from(r.multiply(r.to(a), r.to(b))); }, reduction_);
+        }
+        /*finds base ^ exponent modulo the modulus in O(log(exponent))*/
+        auto pow(std::uint64_t base, std::uint64_t exponent) const -> std::uint64_t {
+            return std::visit([&](const auto& r) {
+                return r.from(modular_detail::pow(r, r.to(base), exponent));
+            }, reduction_);
+        }
+        /*raises every base to the same exponent, lanes bases at a time so the
+         * independent multiplications of a block overlap in the pipeline*/
+        auto pow(std::span<const std::uint64_t> bases, std::uint64_t exponent,
+            std::span<std::uint64_t> results) const -> void {
+            constexpr std::size_t lanes{ 8 };
+            if (bases.size() != results.size()) {
+                throw std::invalid_argument("Results must be as long as bases.");
+            }
+            std::visit([&](const auto& r) {
+                std::size_t i = 0;
+                for (; i + lanes <= bases.size(); i += lanes) {
+                    std::array<std::uint64_t, lanes> power{};
+                    std::array<std::uint64_t, lanes> result{};
+                    for (std::size_t l = 0; l < lanes; ++l) {
+                        power[l] = r.to(bases[i + l]);
+                        result[l] = r.one();
+                    }
+                    for (std::uint64_t e = exponent; e > 0; e /= 2) {
+                        if (e % 2 == 1) {
+                            for (std::size_t l = 0; l < lanes; ++l) result[l] = r.multiply(result[l], power[l]);
+                        }
+                        for (std::size_t l = 0; l < lanes; ++l) power[l] = r.multiply(power[l], power[l]);
+                    }
+                    for (std::size_t l = 0; l < lanes; ++l) results[i + l] = r.from(result[l]);
+                }
+                for (; i < bases.size(); ++i) {
+                    results[i] = r.from(modular_detail::pow(r, r.to(bases[i]), exponent));
+                }
+            }, reduction_);
+        }
+        /*finds (if exists) inv such that value * inv = 1 modulo the modulus*/
+        auto inverse(std::uint64_t value) const -> std::uint64_t {
+            const std::uint64_t n = modulus();
+            __int128 t = 0;
+            __int128 next_t = 1;
+            std::uint64_t r = n;
+            std::uint64_t next_r = value % n;
+            while (next_r != 0) {
+                const std::uint64_t q = r / next_r;
+                t = std::exchange(next_t, t - static_cast<__int128>(q) * next_t);
+                r = std::exchange(next_r, r - q * next_r);
+            }
+            if (r != 1) {
+                throw std::invalid_argument("Inverse does not exist.");
+            }
+            return static_cast<std::uint64_t>(t < 0 ? t + n : t);
+        }
+        /*inverts every value with a single inverse by Montgomery's trick:
+         * with prefix products p_i = v_0 ... v_i, 1 / v_i = p_(i-1) / p_i and
+         * 1 / p_(i-1) = v_i / p_i, so walking back from 1 / p_last costs
+         * three multiplications per value*/
+        auto inverse(std::span<const std::uint64_t> values, std::span<std::uint64_t> results) const -> void {
+            if (values.size() != results.size()) {
+                throw std::invalid_argument("Results must be as long as values.");
+            }
+            if (values.empty()) return;
+            std::visit([&](const auto& r) {
+                std::uint64_t product = r.one();
+                for (std::size_t i = 0; i < values.size(); ++i) {
+                    product = r.multiply(product, r.to(values[i]));
+                    results[i] = product;
+                }
+                std::uint64_t inverse_product = r.to(inverse(r.from(product)));
+                for (std::size_t i = values.size() - 1; i > 0; --i) {
+                    results[i] = r.from(r.multiply(inverse_product, results[i - 1]));
+                    inverse_product = r.multiply(inverse_product, r.to(values[i]));
+                }
+                results[0] = r.from(inverse_product);
+            }, reduction_);
+        }
+
+    private:
+        using reduction = std::variant<modular_detail::montgomery, modular_detail::barrett>;
+
+        static auto make_reduction(std::uint64_t modulus) -> reduction {
+            if (modulus == 0) {
+                throw std::invalid_argument("Modulus must be positive.");
+            }
+            if (modulus % 2 == 1 && modulus > 1) return modular_detail::montgomery{ modulus };
+            return modular_detail::barrett{ modulus };
+        }
+
+        reduction reduction_;
+    };
     /*returns primes smaller than up_to*/
     inline auto sieve_of_eratosthenes(std::size_t up_to) {
         std::vector<bool> is_prime(up_to + 1, true);
@@ -78,6 +283,105 @@ namespace number_theory
         }
         return primes;
     }
+    /*state of the segmented sieve: bit j of the segment starting at low
+     * stands for the odd number low + 2j + 1, a segment takes 32 KiB so it
+     * stays in the L1 cache while every base prime crosses it*/
+    namespace sieve_detail {
+        inline constexpr std::size_t segment_words{ 4096 };
+        inline constexpr std::uint64_t segment_span{ segment_words * 64 * 2 };
+        // consecutive segments sieved by one thread before the primes are handed out
+        inline constexpr std::uint64_t segments_per_task{ 16 };
+
+        /*odd primes p with p * p < up_to*/
+        inline auto base_primes(std::uint64_t up_to) {
+            std::uint64_t limit = static_cast<std::uint64_t>(std::sqrt(static_cast<double>(up_to)));
+            while (limit * limit >= up_to) --limit;
+            while ((limit + 1) * (limit + 1) < up_to) ++limit;
+            std::vector<bool> composite(limit / 2 + 1, false);
+            std::vector<std::uint64_t> primes;
+            for (std::uint64_t i = 3; i <= limit; i += 2) {
+                if (composite[i / 2]) continue;
+                primes.push_back(i);
+                for (std::uint64_t j = i * i; j <= limit; j += 2 * i) {
+                    composite[j / 2] = true;
+                }
+            }
+            return primes;
+        }
+        /*sieves the odd numbers of [low, min(low + segment_span, up_to)),
+         * low is a multiple of segment_span, and appends their primes*/
+        inline auto sieve_segment(std::uint64_t low, std::uint64_t up_to,
+            const std::vector<std::uint64_t>& base, std::vector<std::uint64_t>& bits,
+            std::vector<std::uint64_t>& primes) {
+            const std::uint64_t high = std::min(low + segment_span, up_to);
+            const std::uint64_t count = (high - low) / 2;
+            std::ranges::fill(bits, ~std::uint64_t{ 0 });
+            for (const std::uint64_t p : base) {
+                if (p * p >= high) break;
+                // multiples below p * p were crossed off by smaller primes
+                std::uint64_t start = std::max(p * p, (low + p - 1) / p * p);
+                if (start % 2 == 0) start += p;
+                for (std::uint64_t j = (start - low) / 2; j < count; j += p) {
+                    bits[j / 64] &= ~(std::uint64_t{ 1 } << (j % 64));
+                }
+            }
+            if (low == 0) bits[0] &= ~std::uint64_t{ 1 };
+            for (std::uint64_t w = 0; w * 64 < count; ++w) {
+                std::uint64_t word = bits[w];
+                if ((w + 1) * 64 > count) word &= (std::uint64_t{ 1 } << (count - w * 64)) - 1;
+                while (word != 0) {
+                    primes.push_back(low + 2 * (w * 64 + std::countr_zero(word)) + 1);
+                    word &= word - 1;
+                }
+            }
+        }
+    }
+    /*calls callback(p) for every prime p smaller than up_to in increasing
+     * order. Only odd numbers are stored, one bit each, in L1-sized segments
+     * that threads sieve in parallel, so memory stays bounded by the number
+     * of threads and the base primes up to sqrt(up_to). The callback runs on
+     * the calling thread*/
+    template <typename Callback>
+    inline auto segmented_sieve(std::uint64_t up_to, Callback callback) {
+        using namespace sieve_detail;
+        if (up_to <= 2) return;
+        callback(std::uint64_t{ 2 });
+        const auto base = base_primes(up_to);
+        const std::uint64_t segments = (up_to + segment_span - 1) / segment_span;
+        const std::uint64_t threads = std::clamp<std::uint64_t>(segments / segments_per_task, 1,
+            std::max(1U, std::thread::hardware_concurrency()));
+        std::vector<std::vector<std::uint64_t>> found(threads);
+        for (std::uint64_t first = 0; first < segments; first += threads * segments_per_task) {
+            auto task = [&](std::uint64_t t) {
+                std::vector<std::uint64_t> bits(segment_words);
+                found[t].clear();
+                const std::uint64_t begin = first + t * segments_per_task;
+                const std::uint64_t end = std::min(begin + segments_per_task, segments);
+                for (std::uint64_t s = begin; s < end; ++s) {
+                    sieve_segment(s * segment_span, up_to, base, bits, found[t]);
+                }
+            };
+            if (threads == 1) {
+                task(0);
+            }
+            else {
+                std::vector<std::jthread> workers;
+                workers.reserve(threads);
+                for (std::uint64_t t = 0; t < threads; ++t) {
+                    workers.emplace_back(task, t);
+                }
+            }
+            for (const auto& primes : found) {
+                for (const std::uint64_t p : primes) callback(p);
+            }
+        }
+    }
+    /*returns primes smaller than up_to, computed by segmented_sieve*/
+    inline auto segmented_sieve(std::uint64_t up_to) {
+        std::vector<std::uint64_t> primes;
+        segmented_sieve(up_to, [&](std::uint64_t p) { primes.push_back(p); });
+        return primes;
+    }
     /*decomposes a number into powers of primes*/
     inline auto decompose(std::integral auto value) {
         std::vector<std::pair<int, int>> primeFactors;
@@ -96,18 +400,252 @@ namespace number_theory
         }
         return primeFactors;
     }
-    /*calculates Euler’s Totient Function*/
-    inline auto euler_totient(std::integral auto value) {
-    std:size_t result = 0;
-        for (int i = 1; i <= value; i++) {
-            if (std::gcd(i, value) == 1) {
-                result++;
+    /*building blocks of factorize: a table of small primes for trial
+     * division, the deterministic Miller-Rabin test and Pollard-Brent rho*/
+    namespace factorization_detail {
+        using modular_detail::montgomery;
+
+        inline constexpr std::uint64_t trial_limit{ 1024 };
+        inline constexpr auto small_primes = [] {
+            std::array<bool, trial_limit> composite{};
+            std::array<std::uint32_t, 172> primes{};
+            std::size_t count = 0;
+            for (std::uint32_t i = 2; i < trial_limit; ++i) {
+                if (composite[i]) continue;
+                primes[count++] = i;
+                for (std::uint32_t j = i * i; j < trial_limit; j += i) composite[j] = true;
+            }
+            return primes;
+        }();
+        /*Miller-Rabin for odd n > 2, these seven bases decide every n < 2^64*/
+        inline auto miller_rabin(std::uint64_t n) {
+            const montgomery m{ n };
+            const std::uint64_t one = m.to(1);
+            const std::uint64_t minus_one = m.to(n - 1);
+            const int s = std::countr_zero(n - 1);
+            const std::uint64_t d = (n - 1) >> s;
+            for (const std::uint64_t a : { 2ULL, 325ULL, 9375ULL, 28178ULL, 450775ULL, 9780504ULL, 1795265022ULL }) {
+                if (a % n == 0) continue;
+                std::uint64_t x = m.pow(m.to(a), d);
+                if (x == one || x == minus_one) continue;
+                bool composite = true;
+                for (int i = 1; i < s && composite; ++i) {
+                    x = m.multiply(x, x);
+                    composite = x != minus_one;
+                }
+                if (composite) return false;
+            }
+            return true;
+        }
+
+        /*a non-trivial divisor of the odd composite n by Pollard's rho with
+         * Brent's cycle detection, gcds are taken once per batch of products*/
+        inline auto pollard_brent(std::uint64_t n) {
+            constexpr std::uint64_t batch = 128;
+            const montgomery m{ n };
+            const auto distance = [](std::uint64_t a, std::uint64_t b) { return a > b ? a - b : b - a; };
+            for (std::uint64_t c = 1;; ++c) {
+                const std::uint64_t increment = m.to(c);
+                const auto f = [&](std::uint64_t x) { return m.add(m.multiply(x, x), increment); };
+                std::uint64_t y = m.to(2);
+                std::uint64_t x = y;
+                std::uint64_t saved = y;
+                std::uint64_t product = m.to(1);
+                std::uint64_t g = 1;
+                for (std::uint64_t r = 1; g == 1; r *= 2) {
+                    x = y;
+                    for (std::uint64_t i = 0; i < r; ++i) y = f(y);
+                    for (std::uint64_t k = 0; k < r && g == 1; k += batch) {
+                        saved = y;
+                        for (std::uint64_t i = 0; i < std::min(batch, r - k); ++i) {
+                            y = f(y);
+                            product = m.multiply(product, distance(x, y));
+                        }
+                        g = std::gcd(product, n);
+                    }
+                }
+                if (g == n) {
+                    // the batch overshot, repeat its steps one gcd at a time
+                    do {
+                        saved = f(saved);
+                        g = std::gcd(distance(x, saved), n);
+                    } while (g == 1);
+                }
+                if (g != n) return g;
+            }
+        }
+    }
+    /*checks if value is prime, deterministic for every 64-bit value*/
+    inline auto is_prime(std::uint64_t value) {
+        if (value < 2) return false;
+        for (const std::uint64_t p : factorization_detail::small_primes) {
+            if (value % p == 0) return value == p;
+        }
+        if (value < factorization_detail::trial_limit * factorization_detail::trial_limit) return true;
+        return factorization_detail::miller_rabin(value);
+    }
+    /*decomposes a 64-bit number into powers of primes in increasing order:
+     * trial division by the primes below 1024, then Miller-Rabin decides
+     * whether what is left is prime and Pollard-Brent splits it if not*/
+    inline auto factorize(std::uint64_t value) {
+        std::vector<std::pair<std::uint64_t, int>> factors;
+        if (value < 2) return factors;
+        for (const std::uint64_t p : factorization_detail::small_primes) {
+            int count = 0;
+            while (value % p == 0) {
+                ++count;
+                value /= p;
+            }
+            if (count > 0) factors.emplace_back(p, count);
+        }
+        std::vector<std::uint64_t> large;
+        std::vector<std::uint64_t> pending;
+        if (value > 1) pending.push_back(value);
+        while (!pending.empty()) {
+            const std::uint64_t n = pending.back();
+            pending.pop_back();
+            if (is_prime(n)) {
+                large.push_back(n);
+                continue;
             }
+            const std::uint64_t d = factorization_detail::pollard_brent(n);
+            pending.push_back(d);
+            pending.push_back(n / d);
+        }
+        std::ranges::sort(large);
+        for (const std::uint64_t p : large) {
+            if (!factors.empty() && factors.back().first == p) ++factors.back().second;
+            else factors.emplace_back(p, 1);
+        }
+        return factors;
+    }
+    /*factorizes every value, consecutive chunks of values are handled by
+     * one thread each*/
+    inline auto factorize_batch(std::span<const std::uint64_t> values) {
+        constexpr std::size_t minimal_chunk{ 1024 };
+        std::vector<std::vector<std::pair<std::uint64_t, int>>> result(values.size());
+        const std::size_t threads = std::clamp<std::size_t>(values.size() / minimal_chunk, 1,
+            std::max(1U, std::thread::hardware_concurrency()));
+        const std::size_t chunk = (values.size() + threads - 1) / threads;
+        auto task = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) result[i] = factorize(values[i]);
+        };
+        if (threads == 1) {
+            task(0, values.size());
+            return result;
+        }
+        std::vector<std::jthread> workers;
+        workers.reserve(threads);
+        for (std::size_t begin = 0; begin < values.size(); begin += chunk) {
+            workers.emplace_back(task, begin, std::min(begin + chunk, values.size()));
         }
+        workers.clear();
         return result;
     }
-    /*finds the largest power pow of prime such that prime^pow divides value*/
-    inline auto largest_power_of_prime_dividing_factorial(std::integral auto value, std::integral auto prime) {
+    /*calculates Euler’s Totient Function from the prime factorization,
+     * phi(p1^e1 ... pk^ek) = p1^(e1 - 1) (p1 - 1) ... pk^(ek - 1) (pk - 1)*/
+    inline auto euler_totient(std::integral auto value) {
+        if (value < 1) return std::size_t{ 0 };
+        std::size_t result = 1;
+        for (const auto& [p, e] : factorize(static_cast<std::uint64_t>(value))) {
+            result *= p - 1;
+            for (int i = 1; i < e; ++i) result *= p;
+        }
+        return result;
+    }
+    /*tables of multiplicative functions for every n <= up_to, entries for
+     * 0 are 0 and the smallest prime factor of 1 is 0*/
+    struct multiplicative_tables {
+        std::vector<std::uint32_t> smallest_prime_factor;
+        std::vector<std::uint32_t> totient;
+        std::vector<std::int8_t> mobius;
+        std::vector<std::uint64_t> divisor_sum;
+    };
+    /*runs task(begin, end) on consecutive chunks of [begin, end), one chunk
+     * per hardware thread, the chunk lengths are multiples of granularity*/
+    template <typename Task>
+    inline auto for_each_chunk(std::uint64_t begin, std::uint64_t end, std::uint64_t granularity, Task task) {
+        const std::uint64_t pieces = (end - begin + granularity - 1) / granularity;
+        const std::uint64_t threads = std::clamp<std::uint64_t>(pieces, 1,
+            std::max(1U, std::thread::hardware_concurrency()));
+        if (threads == 1) {
+            task(begin, end);
+            return;
+        }
+        const std::uint64_t chunk = (pieces + threads - 1) / threads * granularity;
+        std::vector<std::jthread> workers;
+        workers.reserve(threads);
+        for (std::uint64_t first = begin; first < end; first += chunk) {
+            workers.emplace_back(task, first, std::min(first + chunk, end));
+        }
+    }
+    /*fills the tables for every n <= up_to < 2^32. Smallest prime factors
+     * come from a segmented sieve, every segment crosses off the multiples of
+     * the primes up to sqrt(up_to) on its own. Then, as in the linear sieve,
+     * n with p = spf(n) is computed from m = n / p in O(1), so the whole pass
+     * is O(N). Since m <= n / 2, all n in [2^k, 2^(k+1)) only need values
+     * below 2^k and every such block is split between threads*/
+    inline auto multiplicative_function_tables(std::uint64_t up_to) {
+        constexpr std::uint64_t segment_length{ 1 << 16 };
+        if (up_to >= (std::uint64_t{ 1 } << 32)) {
+            throw std::invalid_argument("Tables are limited to values below 2^32.");
+        }
+        const std::uint64_t size = up_to + 1;
+        multiplicative_tables tables{
+            std::vector<std::uint32_t>(size), std::vector<std::uint32_t>(size),
+            std::vector<std::int8_t>(size), std::vector<std::uint64_t>(size) };
+        auto& spf = tables.smallest_prime_factor;
+        std::vector<std::uint64_t> primes{ 2 };
+        for (const std::uint64_t p : sieve_detail::base_primes(size)) primes.push_back(p);
+        for_each_chunk(2, size, segment_length, [&](std::uint64_t begin, std::uint64_t end) {
+            for (std::uint64_t low = begin; low < end; low += segment_length) {
+                const std::uint64_t high = std::min(low + segment_length, end);
+                for (const std::uint64_t p : primes) {
+                    if (p * p >= high) break;
+                    for (std::uint64_t n = std::max(p * p, (low + p - 1) / p * p); n < high; n += p) {
+                        if (spf[n] == 0) spf[n] = static_cast<std::uint32_t>(p);
+                    }
+                }
+                for (std::uint64_t n = low; n < high; ++n) {
+                    if (spf[n] == 0) spf[n] = static_cast<std::uint32_t>(n);
+                }
+            }
+        });
+        if (size > 1) {
+            tables.totient[1] = 1;
+            tables.mobius[1] = 1;
+            tables.divisor_sum[1] = 1;
+        }
+        auto fill = [&](std::uint64_t begin, std::uint64_t end) {
+            for (std::uint64_t n = begin; n < end; ++n) {
+                const std::uint32_t p = spf[n];
+                const std::uint64_t m = n / p;
+                if (spf[m] != p) {
+                    tables.totient[n] = tables.totient[m] * (p - 1);
+                    tables.mobius[n] = static_cast<std::int8_t>(-tables.mobius[m]);
+                    tables.divisor_sum[n] = tables.divisor_sum[m] * (p + 1);
+                    continue;
+                }
+                tables.totient[n] = tables.totient[m] * p;
+                tables.mobius[n] = 0;
+                // n = p^e k with k coprime to p
+                std::uint64_t k = m / p;
+                std::uint64_t power = std::uint64_t{ p } * p;
+                while (k % p == 0) {
+                    k /= p;
+                    power *= p;
+                }
+                tables.divisor_sum[n] = tables.divisor_sum[k] * ((power * p - 1) / (p - 1));
+            }
+        };
+        for (std::uint64_t low = 2; low < size; low *= 2) {
+            for_each_chunk(low, std::min(2 * low, size), segment_length, fill);
+        }
+        return tables;
+    }
+    /*finds the largest power pow of prime such that prime^pow divides value,
+     * value may be a big_integer such as factorial(n)*/
+    inline auto largest_power_of_prime_dividing_factorial(integer_like auto value, std::integral auto prime) {
         using I = decltype(prime);
         I pow{ 0 };
         while (value % prime == 0) {
@@ -116,6 +654,59 @@ namespace number_theory
         }
         return pow;
     }
+    /*n-th Fibonacci number by fast doubling: from F(k) and F(k + 1) it finds
+     * F(2k) = F(k) (2 F(k + 1) - F(k)) and F(2k + 1) = F(k)^2 + F(k + 1)^2,
+     * one step per bit of n, so the cost is that of a few products of the
+     * size of the result instead of n additions*/
+    inline auto fibonacci(std::uint64_t n) -> big_integer {
+        big_integer current{ 0 };
+        big_integer next{ 1 };
+        for (int bit = std::bit_width(n); bit-- > 0;) {
+            big_integer doubled = current * ((next << 1) - current);
+            big_integer doubled_next = current * current + next * next;
+            if (((n >> bit) & 1) != 0) {
+                next = doubled + doubled_next;
+                current = std::move(doubled_next);
+            }
+            else {
+                current = std::move(doubled);
+                next = std::move(doubled_next);
+            }
+        }
+        return current;
+    }
+    namespace factorial_detail {
+        /*numbers of a leaf of the product tree, multiplied in a limb until it
+         * would overflow*/
+        inline constexpr std::uint64_t leaf_size{ 32 };
+        /*product of the odd parts of low, ..., high - 1: both halves of the
+         * range are multiplied separately, so every product is of two factors
+         * of similar length and Karatsuba's method pays off*/
+        inline auto odd_part_product(std::uint64_t low, std::uint64_t high) -> big_integer {
+            if (high - low > leaf_size) {
+                const std::uint64_t middle = low + (high - low) / 2;
+                return odd_part_product(low, middle) * odd_part_product(middle, high);
+            }
+            big_integer product{ 1 };
+            std::uint64_t limb = 1;
+            for (std::uint64_t i = low; i < high; ++i) {
+                const std::uint64_t odd = i >> std::countr_zero(i);
+                if (limb > UINT64_MAX / odd) {
+                    product *= limb;
+                    limb = 1;
+                }
+                limb *= odd;
+            }
+            product *= limb;
+            return product;
+        }
+    }
+    /*n! as the product tree of the odd parts of 1, ..., n shifted by the
+     * n - popcount(n) factors of two (Legendre's formula for p = 2)*/
+    inline auto factorial(std::uint64_t n) -> big_integer {
+        if (n < 2) return big_integer{ 1 };
+        return factorial_detail::odd_part_product(1, n + 1) << (n - std::popcount(n));
+    }
     // Function to solve a system of linear congruences
     template <std::integral I>
     inline auto linear_congruence_solver(std::vector<I> as, std::vector<I> bs, std::vector<std::size_t> mods) {
@@ -160,6 +751,32 @@ namespace tests {
         assert(number_theory::modular_inverse<11>(5) == 9);
         return true;
     }
+    bool test_runtime_modulus_function() {
+        // Test 5b: Runtime modulus agrees with the template versions, odd (Montgomery) and even (Barrett)
+        const number_theory::runtime_modulus odd{ 13 };
+        assert(odd.pow(4, 3) == static_cast<std::uint64_t>(number_theory::modular_pow<13>(4, 3)));
+        assert(odd.inverse(3) == 9);
+        const number_theory::runtime_modulus even{ 10 };
+        assert(even.pow(2, 3) == 8 && even.pow(7, 4) == 1 && even.multiply(7, 9) == 3);
+        assert(even.inverse(3) == 7);
+        const number_theory::runtime_modulus large{ (1ULL << 61) - 1 };
+        assert(large.pow(3, (1ULL << 61) - 2) == 1);
+        const number_theory::runtime_modulus wide{ 1ULL << 63 };
+        assert(wide.multiply(3ULL << 61, 5) == 3ULL << 61);
+        std::vector<std::uint64_t> values(1000);
+        for (std::size_t i = 0; i < values.size(); ++i) values[i] = 2 * i + 1;
+        std::vector<std::uint64_t> powers(values.size());
+        std::vector<std::uint64_t> inverses(values.size());
+        for (const auto& m : { large, wide }) {
+            m.pow(values, 12345, powers);
+            m.inverse(values, inverses);
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                assert(powers[i] == m.pow(values[i], 12345));
+                assert(inverses[i] == m.inverse(values[i]) && m.multiply(inverses[i], values[i]) == 1);
+            }
+        }
+        return true;
+    }
     bool test_linear_congruence_solver_function() {
         // Test 5: Linear congruence solver returns correct results
         assert(number_theory::linear_congruence_solver<13>(3, 5) == 6);
@@ -173,6 +790,20 @@ namespace tests {
         assert(primes == expected_primes);
         return true;
     }
+    bool test_segmented_sieve_function() {
+        // Test 6b: Segmented sieve agrees with the sieve of Eratosthenes, also across segments
+        auto primes = number_theory::segmented_sieve(50);
+        std::vector<std::uint64_t> expected_primes = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47 };
+        assert(primes == expected_primes);
+        const std::size_t up_to = 3 * number_theory::sieve_detail::segment_span + 12345;
+        auto reference = number_theory::sieve_of_eratosthenes(up_to);
+        auto segmented = number_theory::segmented_sieve(up_to);
+        assert(std::ranges::equal(reference, segmented));
+        std::size_t count = 0;
+        number_theory::segmented_sieve(1'000'000, [&](std::uint64_t) { ++count; });
+        assert(count == 78498);
+        return true;
+    }
     bool test_prime_factor_decomposition_function() {
         // Test 7: Prime factor decomposition returns correct results
         auto factors = number_theory::decompose(90);
@@ -180,18 +811,89 @@ namespace tests {
         assert(factors == expected_factors);
         return true;
     }
+    bool test_factorize_function() {
+        // Test 7b: Miller-Rabin and Pollard-Brent handle 64-bit values
+        assert(number_theory::is_prime(2) && number_theory::is_prime(1'000'003));
+        assert(!number_theory::is_prime(561) && !number_theory::is_prime(3'215'031'751ULL));
+        assert(number_theory::is_prime((1ULL << 61) - 1));
+        assert(number_theory::is_prime(18'446'744'073'709'551'557ULL));
+        using factors = std::vector<std::pair<std::uint64_t, int>>;
+        assert(number_theory::factorize(90) == factors({ {2, 1}, {3, 2}, {5, 1} }));
+        assert(number_theory::factorize(4'294'967'279ULL * 4'294'967'291ULL) ==
+            factors({ {4'294'967'279ULL, 1}, {4'294'967'291ULL, 1} }));
+        assert(number_theory::factorize(1'000'003ULL * 1'000'003ULL * 1'000'033ULL) ==
+            factors({ {1'000'003ULL, 2}, {1'000'033ULL, 1} }));
+        std::vector<std::uint64_t> values(5000);
+        for (std::size_t i = 0; i < values.size(); ++i) values[i] = 1'000'000'007ULL * (i + 1) + i;
+        auto batch = number_theory::factorize_batch(values);
+        for (std::size_t i = 0; i < values.size(); ++i) assert(batch[i] == number_theory::factorize(values[i]));
+        return true;
+    }
     bool test_euler_totient_function() {
         // Test 8: Euler totient function calculates phi correctly
         assert(number_theory::euler_totient(10) == 4);
         assert(number_theory::euler_totient(15) == 8);
         return true;
     }
+    bool test_multiplicative_function_tables_function() {
+        // Test 8b: Tables agree with the definitions, also across segments
+        const std::size_t up_to = 200'000;
+        auto tables = number_theory::multiplicative_function_tables(up_to);
+        std::vector<std::uint64_t> divisor_sum(up_to + 1, 0);
+        for (std::size_t d = 1; d <= up_to; ++d) {
+            for (std::size_t n = d; n <= up_to; n += d) divisor_sum[n] += d;
+        }
+        assert(tables.divisor_sum == divisor_sum);
+        for (std::size_t n = 2; n <= up_to; ++n) {
+            const auto factors = number_theory::factorize(n);
+            assert(tables.smallest_prime_factor[n] == factors.front().first);
+            const bool square_free = std::ranges::all_of(factors, [](auto f) { return f.second == 1; });
+            const int sign = factors.size() % 2 == 0 ? 1 : -1;
+            assert(tables.mobius[n] == (square_free ? sign : 0));
+            assert(tables.totient[n] == number_theory::euler_totient(n));
+        }
+        assert(tables.totient[1] == 1 && tables.mobius[1] == 1 && tables.smallest_prime_factor[1] == 0);
+        assert(number_theory::euler_totient(1'000'000'007ULL * 1'000'000'009ULL) == 1'000'000'006ULL * 1'000'000'008ULL);
+        return true;
+    }
     bool test_largest_power_of_prime_dividing_factorial_function() {
         // Test 9: Largest power of prime dividing factorial is calculated correctly
         assert(number_theory::largest_power_of_prime_dividing_factorial(10, 2) == 1);
         assert(number_theory::largest_power_of_prime_dividing_factorial(10, 3) == 0);
         return true;
     }
+    bool test_big_integer_function() {
+        const number_theory::big_integer a{ "123456789012345678901234567890" };
+        const number_theory::big_integer b{ "-987654321098765432109876543210" };
+        assert((a * b).to_string() == "-121932631137021795226185032733622923332237463801111263526900");
+        assert(b / a == -8);
+        assert((b % a).to_string() == "-9000000000900000000090");
+        assert(gcd(a, b).to_string() == "9000000000900000000090");
+        assert(a.to_string(16) == "18ee90ff6c373e0ee4e3f0ad2");
+        assert(number_theory::big_integer("18EE90FF6C373E0EE4E3F0AD2", 16) == a);
+        assert(a + b - a == b && -(-a) == a && (a << 70) >> 70 == a);
+        assert(b < a && b < 0 && number_theory::big_integer{} == 0);
+        const number_theory::big_integer power = number_theory::big_integer{ 3 } << 5000;
+        assert(number_theory::big_integer(power.to_string()) == power);
+        assert(power * power / power == power && (power * power + 1) % power == 1);
+        return true;
+    }
+    bool test_fibonacci_function() {
+        assert(number_theory::fibonacci(0) == 0);
+        assert(number_theory::fibonacci(1) == 1);
+        assert(number_theory::fibonacci(100).to_string() == "354224848179261915075");
+        const auto f = number_theory::fibonacci(2000);
+        assert(number_theory::fibonacci(2001) == number_theory::fibonacci(1999) + f);
+        return true;
+    }
+    bool test_factorial_function() {
+        assert(number_theory::factorial(0) == 1);
+        assert(number_theory::factorial(5) == 120);
+        assert(number_theory::factorial(25).to_string() == "15511210043330985984000000");
+        assert(number_theory::factorial(1000) / number_theory::factorial(999) == 1000);
+        assert(number_theory::largest_power_of_prime_dividing_factorial(number_theory::factorial(10), 2) == 8);
+        return true;
+    }
     bool test_linear_congruence_solver_multiple_function() {
         // Test 10: Linear congruence solver for multiple equations returns correct results
         std::vector<int> as = { 3, 4 };
@@ -206,11 +908,18 @@ namespace tests {
         assert(test_coprime_function());
         assert(test_modular_pow_function());
         assert(test_modular_inverse_function());
+        assert(test_runtime_modulus_function());
         assert(test_linear_congruence_solver_function());
         assert(test_sieve_of_eratosthenes_function());
+        assert(test_segmented_sieve_function());
         assert(test_prime_factor_decomposition_function());
+        assert(test_factorize_function());
         assert(test_euler_totient_function());
+        assert(test_multiplicative_function_tables_function());
         assert(test_largest_power_of_prime_dividing_factorial_function());
+        assert(test_big_integer_function());
+        assert(test_fibonacci_function());
+        assert(test_factorial_function());
         assert(test_linear_congruence_solver_multiple_function());
         // Print success message if all tests pass
         std::cout << "All tests passed successfully!" << std::endl;
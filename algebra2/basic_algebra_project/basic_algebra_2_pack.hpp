@@ -1,4 +1,5 @@
 #pragma once
+#include "../../big_integer.hpp"
 #include "gaussian_elimination.hpp"
 
 namespace algebra {
@@ -580,6 +581,81 @@ bool test_of_is_in_image() {
   return true;
 }
 
+bool test_of_step_recording() {
+  namespace ge = algorithms::gaussian_elimination;
+  std::vector v{2, 1, 4, 3};
+  ::ranges::matrix_view m(v, 2, 2, layout::row);
+  auto logged = ge::gaussian_elimiantion_alg<ge::step_recording::operation_log>(
+      m, ge::reducted_form::echelon);
+  assert(logged.recorder.log.size() == 1);
+  assert(logged.recorder.log[0].kind == ge::step_recording::step_kind::subtract);
+  assert(logged.recorder.log[0].target == 1 && logged.recorder.log[0].source == 0);
+  auto formatted = ge::gaussian_elimiantion_alg<ge::step_recording::formatted>(
+      m, ge::reducted_form::echelon);
+  assert(logged.recorder.steps() == formatted.recorder.steps());
+  auto silent = ge::gaussian_elimiantion_alg(m, ge::reducted_form::echelon);
+  assert(silent.recorder.steps().empty());
+  assert(silent.determinant_m == logged.determinant_m);
+
+  return true;
+}
+
+bool test_of_transpose_copy() {
+  std::vector v{1, 2, 3, 4, 5, 6};
+  ::ranges::matrix_view m(v, 2, 3, layout::row);
+  auto [transposed_vector, transposed] = ::ranges::transpose_copy(m);
+  assert((transposed_vector == std::vector{1, 4, 2, 5, 3, 6}));
+  assert(transposed.number_of_rows() == 3 && transposed[2, 1] == 6);
+
+  auto [column_vector, column_major] =
+      ::ranges::to_layout<std::layout_left>(m);
+  assert((column_vector == std::vector{1, 4, 2, 5, 3, 6}));
+  assert(column_major[1, 2] == 6);
+
+  std::vector square{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  ::ranges::matrix_view s(square, 3, 3, layout::row);
+  assert(::ranges::transpose_in_place(s));
+  assert((square == std::vector{1, 4, 7, 2, 5, 8, 3, 6, 9}));
+  assert(!::ranges::transpose_in_place(m));
+
+  return true;
+}
+
+bool test_of_row_expressions() {
+  std::vector v{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  ::ranges::matrix_view m(v, 2, 3, layout::row);
+  m[1] -= 4.0 * m[0];
+  assert((v == std::vector{1.0, 2.0, 3.0, 0.0, -3.0, -6.0}));
+  m[0] += m[1] * 0.5 - m[0];
+  assert((v == std::vector{0.0, -1.5, -3.0, 0.0, -3.0, -6.0}));
+
+  using algorithms::gaussian_elimination::fraction;
+  std::vector<fraction<int>> f{{1, 2}, {1, 3}, {1, 1}, {2, 1}};
+  ::ranges::matrix_view fm(f, 2, 2, layout::row);
+  algorithms::gaussian_elimination::subtract(fm, 0, 1, fraction<int>{1, 2});
+  assert((f[0] == fraction<int>{0, 1} && f[1] == fraction<int>{-2, 3}));
+  assert((f[2] == fraction<int>{1, 1} && f[3] == fraction<int>{2, 1}));
+
+  return true;
+}
+
+bool test_of_big_integer_fractions() {
+  using number_theory::big_integer;
+  using fraction = algorithms::gaussian_elimination::fraction<big_integer>;
+  const big_integer big{"100000000000000000000"};
+  fraction sum = fraction{big * big, 3} + fraction{big * big, 6};
+  assert((sum == fraction{big * big / 2, 1}));
+  assert((fraction{big, 4} / fraction{-big, 2} == fraction{-1, 2}));
+
+  std::vector<fraction> f{{big, 1}, {1, 2}, {big, 3}, {1, 1}};
+  ::ranges::matrix_view fm(f, 2, 2, layout::row);
+  algorithms::gaussian_elimination::subtract(fm, 1, 0, fraction{1, 3});
+  assert((f[0] == fraction{big, 1} && f[1] == fraction{1, 2}));
+  assert((f[2] == fraction{0, 1} && f[3] == fraction{5, 6}));
+
+  return true;
+}
+
 void all_test() {
   assert(test_of_solve());
   assert(test_of_is_in_span());
@@ -588,6 +664,10 @@ void all_test() {
   assert(test_of_base_transition_matrix());
   assert(test_of_is_in_kernel());
   assert(test_of_is_in_image());
+  assert(test_of_step_recording());
+  assert(test_of_transpose_copy());
+  assert(test_of_row_expressions());
+  assert(test_of_big_integer_fractions());
   std::println("\n\nAll Test Passed Succesfully!");
 }
 } // namespace tests_of_algebra
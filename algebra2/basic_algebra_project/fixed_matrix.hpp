@@ -0,0 +1,510 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <expected>
+#include <mdspan>
+#include <utility>
+
+#include "gaussian_elimination.hpp"
+
+
+namespace algebra::fixed {
+
+    using algorithms::gaussian_elimination::error;
+
+
+    /*
+        description:
+            largest size for which determinant, inverse and solve are computed
+       from cofactors, that is by fully unrolled closed formulas. Larger
+       matrices use Gauss-Jordan elimination with partial pivoting
+    */
+    constexpr std::size_t cofactor_limit{4};
+
+
+    /*
+        description:
+            R x C matrix whose shape is part of its type. The values are stored
+       inline in row-major order, so the matrix lives on the stack, can be
+       copied with a single memcpy and can be used in constant expressions.
+       Meant for small matrices (transforms, small systems) for which the
+       runtime extents and the heap allocated storage of matrix_view results
+       cost more than the arithmetic
+    */
+    template <typename T, std::size_t R, std::size_t C>
+    requires(R > 0 && C > 0)
+    struct matrix {
+        using value_type = T;
+        using extents_type = std::extents<std::size_t, R, C>;
+
+        std::array<T, R * C> values{};
+
+
+        [[nodiscard]] static constexpr auto number_of_rows() -> std::size_t {
+            return R;
+        }
+
+
+        [[nodiscard]] static constexpr auto number_of_columns()
+            -> std::size_t {
+            return C;
+        }
+
+
+        [[nodiscard]] static constexpr auto shape()
+            -> std::pair<std::size_t, std::size_t> {
+            return {R, C};
+        }
+
+
+        [[nodiscard]] constexpr auto operator[](std::size_t i, std::size_t j)
+            -> T& {
+            return values[i * C + j];
+        }
+
+
+        [[nodiscard]] constexpr auto operator[](std::size_t i,
+                                                std::size_t j) const
+            -> const T& {
+            return values[i * C + j];
+        }
+
+
+        /*
+            description:
+                mdspan with static extents over the inline storage
+        */
+        [[nodiscard]] constexpr auto view() -> std::mdspan<T, extents_type> {
+            return std::mdspan<T, extents_type>{values.data()};
+        }
+
+
+        [[nodiscard]] constexpr auto view() const
+            -> std::mdspan<const T, extents_type> {
+            return std::mdspan<const T, extents_type>{values.data()};
+        }
+
+
+        /*
+            description:
+                dynamic matrix_view over the inline storage, so that every
+           algorithm written for matrix_view accepts a fixed size matrix
+        */
+        [[nodiscard]] auto as_matrix_view()
+            -> ranges::matrix_view<T, std::layout_right> {
+            return {values.data(), R, C, layout::row};
+        }
+
+
+        [[nodiscard]] auto as_matrix_view() const
+            -> ranges::matrix_view<const T, std::layout_right> {
+            return {values.data(), R, C, layout::row};
+        }
+
+
+        friend constexpr auto operator==(const matrix&, const matrix&)
+            -> bool = default;
+    };
+
+
+    template <typename T, std::size_t N>
+    using square_matrix = matrix<T, N, N>;
+
+
+    /*
+        description:
+            copies an R x C matrix_view (of any layout) into a fixed size
+       matrix, the shape of m must be R x C
+    */
+    template <std::size_t R, std::size_t C, typename T, typename LP>
+    [[nodiscard]] auto from_matrix_view(ranges::matrix_view<T, LP> m)
+        -> matrix<std::remove_const_t<T>, R, C> {
+        assert(m.number_of_rows() == R && m.number_of_columns() == C);
+        matrix<std::remove_const_t<T>, R, C> result{};
+        for (std::size_t i = 0; i < R; ++i) {
+            for (std::size_t j = 0; j < C; ++j) { result[i, j] = m[i, j]; }
+        }
+        return result;
+    }
+
+
+    template <typename T, std::size_t N>
+    [[nodiscard]] constexpr auto identity() -> matrix<T, N, N> {
+        matrix<T, N, N> result{};
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((result.values[I * (N + 1)] = T{1}), ...);
+        }(std::make_index_sequence<N>{});
+        return result;
+    }
+
+
+    template <typename T, std::size_t R, std::size_t C>
+    [[nodiscard]] constexpr auto transpose(const matrix<T, R, C>& m)
+        -> matrix<T, C, R> {
+        matrix<T, C, R> result{};
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((result.values[I] = m.values[(I % R) * C + I / R]), ...);
+        }(std::make_index_sequence<R * C>{});
+        return result;
+    }
+
+
+    namespace detail {
+
+        /*
+            description:
+                entry I of the product a * b, a fold over the inner dimension
+        */
+        template <std::size_t I,
+                  typename T,
+                  std::size_t R,
+                  std::size_t K,
+                  std::size_t C,
+                  std::size_t... L>
+        constexpr auto product_entry(const matrix<T, R, K>& a,
+                                     const matrix<T, K, C>& b,
+                                     std::index_sequence<L...>) -> T {
+            return ((a.values[(I / C) * K + L] * b.values[L * C + I % C]) +
+                    ...);
+        }
+
+
+        template <std::size_t I,
+                  typename T,
+                  std::size_t R,
+                  std::size_t C,
+                  std::size_t... L>
+        constexpr auto product_entry(const matrix<T, R, C>& a,
+                                     const std::array<T, C>& x,
+                                     std::index_sequence<L...>) -> T {
+            return ((a.values[I * C + L] * x[L]) + ...);
+        }
+
+
+        template <typename T>
+        constexpr auto magnitude(T value) -> T {
+            return value < T{0} ? -value : value;
+        }
+
+
+        /*
+            description:
+                Gauss-Jordan elimination with partial pivoting of the system
+           a * X = b, returns X. With a null determinant pointer the right-hand
+           side is transformed as well, otherwise only the determinant of a is
+           accumulated. Used for matrices above cofactor_limit, the loop bounds
+           are compile time constants, so the compiler is free to unroll them
+        */
+        template <std::floating_point T, std::size_t N, std::size_t M>
+        constexpr auto gauss_jordan(matrix<T, N, N> a,
+                                    matrix<T, N, M> b,
+                                    T* determinant = nullptr)
+            -> std::expected<matrix<T, N, M>, error> {
+            T det{1};
+            for (std::size_t k = 0; k < N; ++k) {
+                std::size_t pivot{k};
+                for (std::size_t i = k + 1; i < N; ++i) {
+                    if (magnitude(a[i, k]) > magnitude(a[pivot, k])) {
+                        pivot = i;
+                    }
+                }
+                if (a[pivot, k] == T{0}) {
+                    if (determinant != nullptr) { *determinant = T{0}; }
+                    return std::unexpected(error::not_invertible);
+                }
+                if (pivot != k) {
+                    det = -det;
+                    for (std::size_t j = 0; j < N; ++j) {
+                        std::swap(a[k, j], a[pivot, j]);
+                    }
+                    for (std::size_t j = 0; j < M; ++j) {
+                        std::swap(b[k, j], b[pivot, j]);
+                    }
+                }
+                det *= a[k, k];
+                const T inverse_pivot{T{1} / a[k, k]};
+                for (std::size_t i = determinant == nullptr ? 0 : k + 1; i < N;
+                     ++i) {
+                    if (i == k) { continue; }
+                    const T factor{a[i, k] * inverse_pivot};
+                    for (std::size_t j = k; j < N; ++j) {
+                        a[i, j] -= factor * a[k, j];
+                    }
+                    if (determinant == nullptr) {
+                        for (std::size_t j = 0; j < M; ++j) {
+                            b[i, j] -= factor * b[k, j];
+                        }
+                    }
+                }
+            }
+            if (determinant != nullptr) {
+                *determinant = det;
+                return b;
+            }
+            for (std::size_t i = 0; i < N; ++i) {
+                const T inverse_pivot{T{1} / a[i, i]};
+                for (std::size_t j = 0; j < M; ++j) { b[i, j] *= inverse_pivot; }
+            }
+            return b;
+        }
+
+    }  // namespace detail
+
+
+    /*
+        description:
+            matrix product, every entry is a fold over the inner dimension and
+       the entries themselves are a fold over the result, so the whole product
+       is unrolled at compile time
+    */
+    template <typename T, std::size_t R, std::size_t K, std::size_t C>
+    [[nodiscard]] constexpr auto operator*(const matrix<T, R, K>& a,
+                                           const matrix<T, K, C>& b)
+        -> matrix<T, R, C> {
+        matrix<T, R, C> result{};
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((result.values[I] = detail::product_entry<I>(
+                  a, b, std::make_index_sequence<K>{})),
+             ...);
+        }(std::make_index_sequence<R * C>{});
+        return result;
+    }
+
+
+    /*
+        description:
+            product of a matrix and a column vector
+    */
+    template <typename T, std::size_t R, std::size_t C>
+    [[nodiscard]] constexpr auto operator*(const matrix<T, R, C>& a,
+                                           const std::array<T, C>& x)
+        -> std::array<T, R> {
+        std::array<T, R> result{};
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((result[I] = detail::product_entry<I>(
+                  a, x, std::make_index_sequence<C>{})),
+             ...);
+        }(std::make_index_sequence<R>{});
+        return result;
+    }
+
+
+    /*
+        description:
+            matrix m without row Row and column Column
+    */
+    template <std::size_t Row, std::size_t Column, typename T, std::size_t N>
+    requires(N > 1 && Row < N && Column < N)
+    [[nodiscard]] constexpr auto minor_matrix(const matrix<T, N, N>& m)
+        -> matrix<T, N - 1, N - 1> {
+        matrix<T, N - 1, N - 1> result{};
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((result.values[I] =
+                  m.values[(I / (N - 1) + (I / (N - 1) >= Row)) * N +
+                           (I % (N - 1) + (I % (N - 1) >= Column))]),
+             ...);
+        }(std::make_index_sequence<(N - 1) * (N - 1)>{});
+        return result;
+    }
+
+
+    /*
+        description:
+            determinant of m. Up to cofactor_limit it is the Laplace expansion
+       along the first row unrolled at compile time, which is exact for integer
+       matrices. Larger matrices must be floating point and are eliminated
+    */
+    template <typename T, std::size_t N>
+    [[nodiscard]] constexpr auto determinant(const matrix<T, N, N>& m) -> T {
+        if constexpr (N == 1) {
+            return m.values[0];
+        } else if constexpr (N == 2) {
+            return m.values[0] * m.values[3] - m.values[1] * m.values[2];
+        } else if constexpr (N <= cofactor_limit) {
+            return [&]<std::size_t... J>(std::index_sequence<J...>) {
+                return (((J % 2 == 0 ? T{1} : T{-1}) * m.values[J] *
+                         determinant(minor_matrix<0, J>(m))) +
+                        ...);
+            }(std::make_index_sequence<N>{});
+        } else {
+            static_assert(std::floating_point<T>,
+                          "determinant of a matrix larger than cofactor_limit "
+                          "requires a floating point type");
+            T det{};
+            (void)detail::gauss_jordan(m, matrix<T, N, 1>{}, &det);
+            return det;
+        }
+    }
+
+
+    /*
+        description:
+            inverse of m. Up to cofactor_limit it is the adjugate divided by the
+       determinant, otherwise Gauss-Jordan elimination of [m | I]. Returns
+       not_invertible for a singular matrix
+    */
+    template <std::floating_point T, std::size_t N>
+    [[nodiscard]] constexpr auto inverse(const matrix<T, N, N>& m)
+        -> std::expected<matrix<T, N, N>, error> {
+        if constexpr (N <= cofactor_limit) {
+            const T det{determinant(m)};
+            if (det == T{0}) { return std::unexpected(error::not_invertible); }
+            if constexpr (N == 1) {
+                return matrix<T, 1, 1>{{T{1} / det}};
+            } else {
+                const T inverse_det{T{1} / det};
+                matrix<T, N, N> result{};
+                [&]<std::size_t... I>(std::index_sequence<I...>) {
+                    ((result.values[I] =
+                          ((I / N + I % N) % 2 == 0 ? inverse_det
+                                                    : -inverse_det) *
+                          determinant(minor_matrix<I % N, I / N>(m))),
+                     ...);
+                }(std::make_index_sequence<N * N>{});
+                return result;
+            }
+        } else {
+            return detail::gauss_jordan(m, identity<T, N>());
+        }
+    }
+
+
+    /*
+        description:
+            solves a * X = b for every column of b. Up to cofactor_limit it uses
+       Cramer's rule, otherwise Gauss-Jordan elimination of [a | b]
+    */
+    template <std::floating_point T, std::size_t N, std::size_t M>
+    [[nodiscard]] constexpr auto solve(const matrix<T, N, N>& a,
+                                       const matrix<T, N, M>& b)
+        -> std::expected<matrix<T, N, M>, error> {
+        if constexpr (N <= cofactor_limit) {
+            const T det{determinant(a)};
+            if (det == T{0}) { return std::unexpected(error::not_invertible); }
+            const T inverse_det{T{1} / det};
+            matrix<T, N, M> result{};
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                // entry (i, j) of X replaces column i of a with column j of b
+                ((result.values[I] =
+                      inverse_det * determinant([&] {
+                          matrix<T, N, N> replaced{a};
+                          for (std::size_t k = 0; k < N; ++k) {
+                              replaced[k, I / M] = b[k, I % M];
+                          }
+                          return replaced;
+                      }())),
+                 ...);
+            }(std::make_index_sequence<N * M>{});
+            return result;
+        } else {
+            return detail::gauss_jordan(a, b);
+        }
+    }
+
+
+    /*
+        description:
+            solves a * x = y for a single right-hand side
+    */
+    template <std::floating_point T, std::size_t N>
+    [[nodiscard]] constexpr auto solve(const matrix<T, N, N>& a,
+                                       const std::array<T, N>& y)
+        -> std::expected<std::array<T, N>, error> {
+        auto x{solve(a, matrix<T, N, 1>{y})};
+        if (!x) { return std::unexpected(x.error()); }
+        return x->values;
+    }
+
+}  // namespace algebra::fixed
+
+
+namespace tests_of_fixed_matrix {
+
+    using algebra::fixed::matrix;
+
+
+    constexpr bool close(double a, double b) {
+        const double difference{a - b};
+        return (difference < 0 ? -difference : difference) <= 1e-9;
+    }
+
+
+    // everything below is evaluated by the compiler
+    constexpr matrix<int, 2, 3> a{{1, 2, 3, 4, 5, 6}};
+    constexpr matrix<int, 3, 2> b{{7, 8, 9, 10, 11, 12}};
+    static_assert(a * b == matrix<int, 2, 2>{{58, 64, 139, 154}});
+    static_assert(algebra::fixed::transpose(a) ==
+                  matrix<int, 3, 2>{{1, 4, 2, 5, 3, 6}});
+    static_assert(algebra::fixed::determinant(
+                      matrix<int, 3, 3>{{7, 2, 4, 5, 5, 3, 7, 4, 9}}) == 123);
+    static_assert(algebra::fixed::determinant(matrix<int, 4, 4>{
+                      {1, 0, 2, -1, 3, 0, 0, 5, 2, 1, 4, -3, 1, 0, 5, 0}}) ==
+                  30);
+    static_assert(close(
+        algebra::fixed::inverse(matrix<double, 2, 2>{{4.0, 7.0, 2.0, 6.0}})
+            .value()[0, 1],
+        -0.7));
+    static_assert(!algebra::fixed::inverse(
+                       matrix<double, 2, 2>{{1.0, 2.0, 2.0, 4.0}})
+                       .has_value());
+
+
+    inline bool test_of_small_matrices() {
+        matrix<double, 3, 3> m{{7, 2, 4, 5, 5, 3, 7, 4, 9}};
+        auto x = algebra::fixed::solve(m, std::array{1.0, 0.0, 0.0}).value();
+        assert(close(x[0], 11.0 / 41) && close(x[1], -8.0 / 41) &&
+               close(x[2], -5.0 / 41));
+
+        auto product = m * algebra::fixed::inverse(m).value();
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                const double entry{product[i, j]};
+                assert(close(entry, i == j ? 1.0 : 0.0));
+            }
+        }
+        assert((m.as_matrix_view()[1, 2] == 3.0));
+        return true;
+    }
+
+
+    inline bool test_of_elimination_path() {
+        // 5 x 5 is above cofactor_limit, so Gauss-Jordan elimination is used
+        matrix<double, 5, 5> m{};
+        for (std::size_t i = 0; i < 5; ++i) {
+            for (std::size_t j = 0; j < 5; ++j) {
+                m[i, j] = i == j ? 10.0 : static_cast<double>(i + 2 * j);
+            }
+        }
+        m[0, 0] = 0.0;  // forces a row swap
+        auto inverse = algebra::fixed::inverse(m).value();
+        auto product = inverse * m;
+        for (std::size_t i = 0; i < 5; ++i) {
+            for (std::size_t j = 0; j < 5; ++j) {
+                const double entry{product[i, j]};
+                assert(close(entry, i == j ? 1.0 : 0.0));
+            }
+        }
+        const double det{algebra::fixed::determinant(m)};
+        assert(close(algebra::fixed::determinant(inverse) * det, 1.0));
+
+        std::array<double, 5> y{1, 2, 3, 4, 5};
+        auto x = algebra::fixed::solve(m, y).value();
+        auto back = m * x;
+        for (std::size_t i = 0; i < 5; ++i) { assert(close(back[i], y[i])); }
+
+        matrix<double, 5, 5> singular{};
+        assert(algebra::fixed::inverse(singular).error() ==
+               algebra::fixed::error::not_invertible);
+        return true;
+    }
+
+
+    inline void all_test() {
+        assert(test_of_small_matrices());
+        assert(test_of_elimination_path());
+        std::println("\n\nAll Fixed Matrix Tests Passed Succesfully!");
+    }
+}  // namespace tests_of_fixed_matrix
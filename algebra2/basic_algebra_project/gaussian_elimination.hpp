@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <concepts>
 #include <cstdint>
 #include <expected>
 #include <iostream>
@@ -10,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "../../integer_like.hpp"
 #include "matrix.hpp"
 
 
@@ -23,7 +25,11 @@ namespace algorithms::gaussian_elimination {
     };
 
 
-    template <std::integral I>
+    // the built-in integers and number_theory::big_integer
+    using number_theory::integer_like;
+
+
+    template <integer_like I>
     struct fraction {
         I numerator{};
         I denominator{1};
@@ -40,7 +46,8 @@ namespace algorithms::gaussian_elimination {
             reduce fraction
     */
         void reduce() {
-            I divider = std::gcd(numerator, denominator);
+            using std::gcd;
+            I divider = gcd(numerator, denominator);
             if (divider != 0) {
                 numerator /= divider;
                 denominator /= divider;
@@ -54,7 +61,7 @@ namespace algorithms::gaussian_elimination {
     };
 
 
-    template <std::integral I>
+    template <integer_like I>
     inline auto operator==(fraction<I> f, fraction<I> g) -> bool {
         return f.numerator == g.numerator && f.denominator == g.denominator;
     }
@@ -63,7 +70,7 @@ namespace algorithms::gaussian_elimination {
         description:
             operations + - * / += -= *= /= on fractions
     */
-    template <std::integral I>
+    template <integer_like I>
     constexpr auto operator+(fraction<I> f, fraction<I> g) -> fraction<I> {
         fraction<I> result{};
         result.numerator =
@@ -74,7 +81,7 @@ namespace algorithms::gaussian_elimination {
     }
 
 
-    template <std::integral I>
+    template <integer_like I>
     constexpr auto operator+=(fraction<I>& f, fraction<I> g) -> fraction<I> {
         f.numerator = f.numerator * g.denominator + g.numerator * f.denominator;
         f.denominator = f.denominator * g.denominator;
@@ -83,7 +90,7 @@ namespace algorithms::gaussian_elimination {
     }
 
 
-    template <std::integral I>
+    template <integer_like I>
     constexpr auto operator-(fraction<I> f, fraction<I> g) -> fraction<I> {
         fraction<I> result;
         result.numerator =
@@ -94,7 +101,7 @@ namespace algorithms::gaussian_elimination {
     }
 
 
-    template <std::integral I>
+    template <integer_like I>
     constexpr auto operator-=(fraction<I>& f, fraction<I> g) -> fraction<I> {
         f.numerator = f.numerator * g.denominator - g.numerator * f.denominator;
         f.denominator = f.denominator * g.denominator;
@@ -103,7 +110,7 @@ namespace algorithms::gaussian_elimination {
     }
 
 
-    template <std::integral I>
+    template <integer_like I>
     constexpr auto operator*(fraction<I> f, fraction<I> g) -> fraction<I> {
         fraction<I> result;
         result.numerator = f.numerator * g.numerator;
@@ -113,7 +120,7 @@ namespace algorithms::gaussian_elimination {
     }
 
 
-    template <std::integral I>
+    template <integer_like I>
     constexpr auto operator*=(fraction<I>& f, fraction<I> g) -> fraction<I> {
         f.numerator = f.numerator * g.numerator;
         f.denominator = f.denominator * g.denominator;
@@ -122,7 +129,7 @@ namespace algorithms::gaussian_elimination {
     }
 
 
-    template <std::integral I>
+    template <integer_like I>
     constexpr auto operator/(fraction<I> f, fraction<I> g) -> fraction<I> {
         fraction<I> result;
         result.numerator = f.numerator * g.denominator;
@@ -132,7 +139,7 @@ namespace algorithms::gaussian_elimination {
     }
 
 
-    template <std::integral I>
+    template <integer_like I>
     constexpr auto operator/=(fraction<I>& f, fraction<I> g) -> fraction<I> {
         f.numerator = f.numerator * g.denominator;
         f.denominator = f.denominator * g.numerator;
@@ -141,7 +148,7 @@ namespace algorithms::gaussian_elimination {
     }
 
 
-    template <std::integral I>
+    template <integer_like I>
     constexpr auto operator*(fraction<I> f, int g) -> fraction<I> {
         f.numerator = f.numerator * g;
         f.reduce();
@@ -149,7 +156,7 @@ namespace algorithms::gaussian_elimination {
     }
 
 
-    template <std::integral I>
+    template <integer_like I>
     constexpr auto operator*=(fraction<I>& f, int g) -> fraction<I> {
         f.numerator = f.numerator * g;
         f.reduce();
@@ -164,7 +171,7 @@ namespace algorithms::gaussian_elimination {
         enables formatting of output data
         for algorirthms::gaussian_elimination::fraction<I>
 */
-template <std::integral I>
+template <algorithms::gaussian_elimination::integer_like I>
 struct std::formatter<algorithms::gaussian_elimination::fraction<I>> {
 
     template <typename FormatParseContext>
@@ -184,17 +191,20 @@ namespace algorithms::gaussian_elimination {
 
     /*
         description:
-            subtracts row_j multiplied by alpha from row_i
+            subtracts row_j multiplied by alpha from row_i in a single pass,
+       row_j is not modified
     */
     template <typename T, typename LP, typename R>
     auto subtract(ranges::matrix_view<T, LP> m,
                   std::size_t row_i,
                   std::size_t row_j,
                   R alpha) {
-        for (std::size_t i = 0; i < m.number_of_columns(); i++) {
-            m[row_j, i] *= alpha;
-            m[row_i, i] -= m[row_j, i];
-            m[row_j, i] /= alpha;
+        if constexpr (std::same_as<LP, std::layout_right>) {
+            m[row_i] -= alpha * m[row_j];
+        } else {
+            for (std::size_t i = 0; i < m.number_of_columns(); i++) {
+                m[row_i, i] -= alpha * m[row_j, i];
+            }
         }
     }
 
@@ -220,7 +230,7 @@ namespace algorithms::gaussian_elimination {
     struct is_fraction : std::false_type {};
 
 
-    template <std::integral I>
+    template <integer_like I>
     struct is_fraction<fraction<I>> : std::true_type {};
 
 
@@ -367,13 +377,150 @@ namespace algorithms::gaussian_elimination {
     };
 
 
+    /*
+        description:
+            policies deciding how the row operations performed by the
+       elimination are recorded. The policy is a template parameter of
+       gaussian_alg_result, so with step_recording::none the calls compile to
+       nothing. Every policy provides swap, subtract and steps, the last one
+       returns the operations as readable strings
+    */
+    namespace step_recording {
+
+        enum class step_kind : std::uint8_t { swap, subtract };
+
+
+        /*
+            description:
+                single row operation, for a swap factor is unused, for a
+           subtraction row target becomes target - factor * source
+        */
+        struct reduction_step {
+            step_kind kind{step_kind::swap};
+            std::uint32_t target{};
+            std::uint32_t source{};
+            fraction<int> factor{};
+        };
+
+
+        inline auto to_string(const reduction_step& step) -> std::string {
+            if (step.kind == step_kind::swap) {
+                return std::format(
+                    "swap R{} with R{}", step.source + 1, step.target + 1);
+            }
+            return std::format(
+                "R{} - {} * R{}", step.target + 1, step.factor, step.source + 1);
+        }
+
+
+        /*
+            description:
+                records nothing, default for determinant, inverse and run
+        */
+        struct none {
+            constexpr void swap(std::size_t /*target*/,
+                                std::size_t /*source*/) {}
+
+
+            constexpr void subtract(std::size_t /*target*/,
+                                    fraction<int> /*factor*/,
+                                    std::size_t /*source*/) {}
+
+
+            [[nodiscard]] auto steps() const -> std::vector<std::string> {
+                return {};
+            }
+        };
+
+
+        /*
+            description:
+                stores the operations in a compact binary log, strings are
+           produced only when steps is called
+        */
+        struct operation_log {
+            std::vector<reduction_step> log;
+
+
+            void swap(std::size_t target, std::size_t source) {
+                log.push_back({step_kind::swap,
+                               static_cast<std::uint32_t>(target),
+                               static_cast<std::uint32_t>(source),
+                               {}});
+            }
+
+
+            void subtract(std::size_t target,
+                          fraction<int> factor,
+                          std::size_t source) {
+                log.push_back({step_kind::subtract,
+                               static_cast<std::uint32_t>(target),
+                               static_cast<std::uint32_t>(source),
+                               factor});
+            }
+
+
+            [[nodiscard]] auto steps() const -> std::vector<std::string> {
+                return log | std::views::transform([](const auto& step) {
+                           return to_string(step);
+                       }) |
+                       std::ranges::to<std::vector>();
+            }
+        };
+
+
+        /*
+            description:
+                formats every operation as soon as it is performed
+        */
+        struct formatted {
+            std::vector<std::string> reduction_steps;
+
+
+            void swap(std::size_t target, std::size_t source) {
+                reduction_steps.push_back(to_string(
+                    {step_kind::swap,
+                     static_cast<std::uint32_t>(target),
+                     static_cast<std::uint32_t>(source),
+                     {}}));
+            }
+
+
+            void subtract(std::size_t target,
+                          fraction<int> factor,
+                          std::size_t source) {
+                reduction_steps.push_back(to_string(
+                    {step_kind::subtract,
+                     static_cast<std::uint32_t>(target),
+                     static_cast<std::uint32_t>(source),
+                     factor}));
+            }
+
+
+            [[nodiscard]] auto steps() const -> std::vector<std::string> {
+                return reduction_steps;
+            }
+        };
+
+
+        template <typename R>
+        concept recorder = requires(R r, const R cr, fraction<int> f) {
+            r.swap(std::size_t{}, std::size_t{});
+            r.subtract(std::size_t{}, f, std::size_t{});
+            { cr.steps() } -> std::same_as<std::vector<std::string>>;
+        };
+
+    }  // namespace step_recording
+
+
     /*
         description:
             struct which holds return values for gaussian elimination function
     */
-    template <typename LP>
+    template <typename LP,
+              step_recording::recorder Recorder = step_recording::none>
     struct gaussian_alg_result {
-        std::vector<std::string> reduction_steps;
+        [[no_unique_address]] Recorder recorder;
         fraction<int> determinant_m{1, 1};
 
         std::vector<fraction<int>> reduced_matrix_vector;
@@ -394,16 +541,15 @@ namespace algorithms::gaussian_elimination {
         description:
             helper function for gaussian_echelon function to swap rows
     */
-    template <typename T, typename LP>
+    template <typename T, typename LP, typename Recorder>
     auto gaussian_echelon_swap(ranges::matrix_view<T, LP> m,
-                               gaussian_alg_result<LP>& result,
+                               gaussian_alg_result<LP, Recorder>& result,
                                std::size_t i) {
         const std::size_t rows = m.number_of_rows();
         for (std::size_t j = i + 1; j < rows; j++) {
             if (m[j, i].numerator != 0) {
                 swap(m, i, j);
-                result.reduction_steps.push_back(
-                    std::format("swap R{} with R{}", j + 1, i + 1));
+                result.recorder.swap(i, j);
                 result.determinant_m *= -1;
             }
         }
@@ -413,9 +559,9 @@ namespace algorithms::gaussian_elimination {
         description:
             helper function for gaussian_echelon function to subtract rows
     */
-    template <typename T, typename LP>
+    template <typename T, typename LP, typename Recorder>
     auto gaussian_echelon_subtract(ranges::matrix_view<T, LP> m,
-                                   gaussian_alg_result<LP>& result,
+                                   gaussian_alg_result<LP, Recorder>& result,
                                    std::size_t i) {
         const std::size_t rows = m.number_of_rows();
         fraction<int> factor;
@@ -423,8 +569,7 @@ namespace algorithms::gaussian_elimination {
             factor = m[k, i] / m[i, i];
             if (factor.numerator != 0) {
                 subtract(m, k, i, factor);
-                result.reduction_steps.push_back(
-                    std::format("R{} - {} * R{}", k + 1, factor, i + 1));
+                result.recorder.subtract(k, factor, i);
             }
         }
     }
@@ -434,9 +579,9 @@ namespace algorithms::gaussian_elimination {
         description:
             helper function to reduce matrix m to echelon form
     */
-    template <typename T, typename LP>
+    template <typename T, typename LP, typename Recorder>
     auto gaussian_echelon(ranges::matrix_view<T, LP> m,
-                          gaussian_alg_result<LP>& result,
+                          gaussian_alg_result<LP, Recorder>& result,
                           operation allowed_operations) {
         const std::size_t rows = m.number_of_rows();
         const bool is_add_allowed{(operation::add & allowed_operations) !=
@@ -459,9 +604,9 @@ namespace algorithms::gaussian_elimination {
         description:
             helper function for gaussian_diagonal to subtract rows
     */
-    template <typename T, typename LP>
+    template <typename T, typename LP, typename Recorder>
     auto gaussian_diagonal_subtract(ranges::matrix_view<T, LP> m,
-                                    gaussian_alg_result<LP>& result) {
+                                    gaussian_alg_result<LP, Recorder>& result) {
         const std::size_t rows = m.number_of_rows();
         fraction<int> factor;
         for (std::size_t i = 0; i < rows; i++) {
@@ -471,8 +616,7 @@ namespace algorithms::gaussian_elimination {
                         factor = m[i, k] / m[k, k];
                         if (factor.numerator != 0) {
                             subtract(m, i, k, factor);
-                            result.reduction_steps.push_back(std::format(
-                                "R{} - {} * R{}", k + 1, factor, i + 1));
+                            result.recorder.subtract(i, factor, k);
                         }
                     }
                 }
@@ -484,9 +628,10 @@ namespace algorithms::gaussian_elimination {
         description:
             helper function for gaussian_diagonal to divide each diagonal element by itself
     */
-    template <typename T, typename LP>
-    auto gaussian_diagonal_divide_by_factor(ranges::matrix_view<T, LP> m,
-                                            gaussian_alg_result<LP>& result) {
+    template <typename T, typename LP, typename Recorder>
+    auto gaussian_diagonal_divide_by_factor(
+        ranges::matrix_view<T, LP> m,
+        gaussian_alg_result<LP, Recorder>& result) {
         const std::size_t rows = m.number_of_rows();
         const std::size_t cols = m.number_of_columns();
         fraction<int> factor;
@@ -505,9 +650,9 @@ namespace algorithms::gaussian_elimination {
         description:
             helper function to reduce matrix m to diagonal form
     */
-    template <typename T, typename LP>
+    template <typename T, typename LP, typename Recorder>
     auto gaussian_diagonal(ranges::matrix_view<T, LP> m,
-                           gaussian_alg_result<LP>& result,
+                           gaussian_alg_result<LP, Recorder>& result,
                            operation allowed_operations) {
         const bool is_add_allowed{(operation::add & allowed_operations) !=
                                   operation::none};
@@ -521,16 +666,18 @@ namespace algorithms::gaussian_elimination {
     /*
         description:
             performs gaussian elimination on matrix m and returns it's
-       determinant, reduced matrix and steps
+       determinant, reduced matrix and steps recorded by Recorder
     */
-    template <typename T, typename LP>
+    template <step_recording::recorder Recorder = step_recording::none,
+              typename T,
+              typename LP>
     auto gaussian_elimiantion_alg(
         ranges::matrix_view<T, LP> m,
         reducted_form reducted,
         operation allowed_operations = operation::swap | operation::add |
                                        operation::multiply)
-        -> gaussian_alg_result<LP> {
-        gaussian_alg_result<LP> result;
+        -> gaussian_alg_result<LP, Recorder> {
+        gaussian_alg_result<LP, Recorder> result;
         auto [fracs, matrix_of_fracs] = convert_to_matrix_of_fractions(m);
         result.rows = matrix_of_fracs.number_of_rows();
         result.cols = matrix_of_fracs.number_of_columns();
@@ -579,8 +726,9 @@ namespace algorithms::gaussian_elimination {
                                                    operation::multiply)
         -> void {
         std::vector<std::string> steps =
-            gaussian_elimiantion_alg(m, reducted, allowed_operations)
-                .reduction_steps;
+            gaussian_elimiantion_alg<step_recording::operation_log>(
+                m, reducted, allowed_operations)
+                .recorder.steps();
         std::print("{}\n", steps);
     }
 
@@ -0,0 +1,340 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <expected>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "gaussian_elimination.hpp"
+
+
+namespace algorithms::lu_decomposition {
+
+    using gaussian_elimination::error;
+
+
+    /*
+        description:
+            factorization P * A = L * U of a square matrix A with partial
+       pivoting. L (unit lower triangular) and U (upper triangular) are stored
+       together in one row-major array, P is stored as the sequence of row
+       swaps performed during the factorization. After a single O(n^3)
+       factorization every solve costs O(n^2), so the object is meant to be
+       reused for many right-hand sides
+    */
+    template <std::floating_point F>
+    class lu_factorization {
+      public:
+        static constexpr std::size_t default_block_size{64};
+
+
+        /*
+            description:
+                factorizes matrix m using blocked right-looking elimination:
+           a panel of block_size columns is factorized with partial pivoting,
+           then the rows to its right are updated with a triangular solve and
+           the trailing submatrix with a single matrix product. Returns
+           not_invertible when a whole pivot column is zero
+        */
+        template <typename T, typename LP>
+        [[nodiscard]] static auto factorize(
+            ranges::matrix_view<T, LP> m,
+            std::size_t block_size = default_block_size)
+            -> std::expected<lu_factorization, error> {
+            if (m.number_of_rows() != m.number_of_columns()) {
+                return std::unexpected(error::not_square);
+            }
+            lu_factorization result{m.number_of_rows()};
+            const std::size_t n{result.n};
+            for (std::size_t i = 0; i < n; ++i) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    result.lu[i * n + j] = static_cast<F>(m[i, j]);
+                }
+            }
+            if (!result.factorize_blocked(std::max(block_size, std::size_t{1}))) {
+                return std::unexpected(error::not_invertible);
+            }
+            return result;
+        }
+
+
+        [[nodiscard]] constexpr auto size() const -> std::size_t { return n; }
+
+
+        /*
+            description:
+                packed factors, the strictly lower part holds L (without its
+           unit diagonal), the upper part holds U
+        */
+        [[nodiscard]] auto factors() const
+            -> ranges::matrix_view<const F, std::layout_right> {
+            return {lu.data(), n, n, layout::row};
+        }
+
+
+        /*
+            description:
+                row swapped with row k in the k-th step of the factorization
+        */
+        [[nodiscard]] auto pivots() const -> std::span<const std::size_t> {
+            return row_swaps;
+        }
+
+
+        /*
+            description:
+                solves A * x = b in place, b is overwritten with x
+        */
+        void solve_in_place(std::span<F> b) const {
+            assert(b.size() == n);
+            for (std::size_t k = 0; k < n; ++k) {
+                std::swap(b[k], b[row_swaps[k]]);
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                const F* row{lu.data() + i * n};
+                F sum{b[i]};
+                for (std::size_t j = 0; j < i; ++j) { sum -= row[j] * b[j]; }
+                b[i] = sum;
+            }
+            for (std::size_t i = n; i-- > 0;) {
+                const F* row{lu.data() + i * n};
+                F sum{b[i]};
+                for (std::size_t j = i + 1; j < n; ++j) {
+                    sum -= row[j] * b[j];
+                }
+                b[i] = sum / row[i];
+            }
+        }
+
+
+        /*
+            description:
+                returns the solution x of A * x = b
+        */
+        template <std::ranges::input_range R>
+        [[nodiscard]] auto solve(R&& b) const -> std::vector<F> {
+            std::vector<F> x{};
+            x.reserve(n);
+            for (auto&& value : b) { x.push_back(static_cast<F>(value)); }
+            solve_in_place(x);
+            return x;
+        }
+
+
+        /*
+            description:
+                solves A * X = B for every column of B at once, returns X
+        */
+        template <typename T, typename LP>
+        [[nodiscard]] auto solve(ranges::matrix_view<T, LP> b) const
+            -> std::pair<std::vector<F>, ranges::matrix_view<F, std::layout_left>> {
+            assert(b.number_of_rows() == n);
+            const std::size_t columns{b.number_of_columns()};
+            std::vector<F> x(n * columns);
+            for (std::size_t j = 0; j < columns; ++j) {
+                std::span<F> column{x.data() + j * n, n};
+                for (std::size_t i = 0; i < n; ++i) {
+                    column[i] = static_cast<F>(b[i, j]);
+                }
+                solve_in_place(column);
+            }
+            ranges::matrix_view view{x.data(), n, columns, layout::column};
+            return std::pair{std::move(x), view};
+        }
+
+
+        /*
+            description:
+                determinant of A, the product of the diagonal of U with the
+           sign of the permutation P
+        */
+        [[nodiscard]] auto determinant() const -> F {
+            F det{permutation_sign};
+            for (std::size_t i = 0; i < n; ++i) { det *= lu[i * n + i]; }
+            return det;
+        }
+
+
+        /*
+            description:
+                inverse of A, obtained by solving A * X = I column by column
+        */
+        [[nodiscard]] auto inverse() const
+            -> std::pair<std::vector<F>, ranges::matrix_view<F, std::layout_left>> {
+            std::vector<F> x(n * n, F{0});
+            for (std::size_t j = 0; j < n; ++j) {
+                std::span<F> column{x.data() + j * n, n};
+                column[j] = F{1};
+                solve_in_place(column);
+            }
+            ranges::matrix_view view{x.data(), n, n, layout::column};
+            return std::pair{std::move(x), view};
+        }
+
+
+      private:
+        explicit lu_factorization(std::size_t size)
+            : n{size}, lu(size * size), row_swaps(size) {}
+
+
+        auto at(std::size_t i, std::size_t j) -> F& { return lu[i * n + j]; }
+
+
+        void swap_rows(std::size_t i, std::size_t j) {
+            std::swap_ranges(lu.begin() + static_cast<std::ptrdiff_t>(i * n),
+                             lu.begin() + static_cast<std::ptrdiff_t>((i + 1) * n),
+                             lu.begin() + static_cast<std::ptrdiff_t>(j * n));
+            permutation_sign = -permutation_sign;
+        }
+
+
+        /*
+            description:
+                unblocked elimination with partial pivoting of the panel made
+           of columns [first, last) and rows [first, n). Row swaps are applied to
+           whole rows, so L to the left and A to the right stay consistent
+        */
+        auto factorize_panel(std::size_t first, std::size_t last) -> bool {
+            for (std::size_t k = first; k < last; ++k) {
+                std::size_t pivot{k};
+                for (std::size_t i = k + 1; i < n; ++i) {
+                    if (std::abs(at(i, k)) > std::abs(at(pivot, k))) {
+                        pivot = i;
+                    }
+                }
+                if (at(pivot, k) == F{0}) { return false; }
+                row_swaps[k] = pivot;
+                if (pivot != k) { swap_rows(pivot, k); }
+
+                const F inverse_pivot{F{1} / at(k, k)};
+                for (std::size_t i = k + 1; i < n; ++i) {
+                    const F factor{at(i, k) *= inverse_pivot};
+                    for (std::size_t j = k + 1; j < last; ++j) {
+                        at(i, j) -= factor * at(k, j);
+                    }
+                }
+            }
+            return true;
+        }
+
+
+        /*
+            description:
+                right-looking blocked LU. For each panel [first, last):
+           U12 = L11^-1 * A12 and A22 -= L21 * U12, where the loops of the
+           update run along rows so that the inner loop is contiguous
+        */
+        auto factorize_blocked(std::size_t block_size) -> bool {
+            for (std::size_t first = 0; first < n; first += block_size) {
+                const std::size_t last{std::min(first + block_size, n)};
+                if (!factorize_panel(first, last)) { return false; }
+                if (last == n) { break; }
+
+                for (std::size_t k = first; k < last; ++k) {
+                    for (std::size_t i = k + 1; i < last; ++i) {
+                        const F factor{at(i, k)};
+                        for (std::size_t j = last; j < n; ++j) {
+                            at(i, j) -= factor * at(k, j);
+                        }
+                    }
+                }
+
+                for (std::size_t i = last; i < n; ++i) {
+                    F* row{lu.data() + i * n};
+                    for (std::size_t k = first; k < last; ++k) {
+                        const F factor{row[k]};
+                        const F* pivot_row{lu.data() + k * n};
+                        for (std::size_t j = last; j < n; ++j) {
+                            row[j] -= factor * pivot_row[j];
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+
+
+        std::size_t n{};
+        std::vector<F> lu{};
+        std::vector<std::size_t> row_swaps{};
+        F permutation_sign{1};
+    };
+
+
+    /*
+        description:
+            factorizes matrix m, shortcut for lu_factorization<F>::factorize
+    */
+    template <std::floating_point F = double, typename T, typename LP>
+    [[nodiscard]] auto factorize(
+        ranges::matrix_view<T, LP> m,
+        std::size_t block_size = lu_factorization<F>::default_block_size)
+        -> std::expected<lu_factorization<F>, error> {
+        return lu_factorization<F>::factorize(m, block_size);
+    }
+
+}  // namespace algorithms::lu_decomposition
+
+
+namespace tests_of_lu_decomposition {
+
+    template <std::floating_point F>
+    inline bool close(F a, F b) {
+        return std::abs(a - b) <= static_cast<F>(1e-9) * std::max(F{1}, std::abs(b));
+    }
+
+
+    inline bool test_of_factorization() {
+        // the first pivot is zero, so the factorization must swap rows
+        std::vector v{0.0, 2.0, 1.0, 1.0, 1.0, 1.0, 2.0, 1.0, 3.0};
+        ::ranges::matrix_view m(v, 3, 3, layout::row);
+        auto lu = algorithms::lu_decomposition::factorize(m);
+        assert(lu.has_value());
+        assert(lu->pivots()[0] == 2);
+        assert(close(lu->determinant(), -3.0));
+
+        std::vector singular{1.0, 2.0, 2.0, 4.0};
+        ::ranges::matrix_view s(singular, 2, 2, layout::row);
+        assert(algorithms::lu_decomposition::factorize(s).error() ==
+               algorithms::gaussian_elimination::error::not_invertible);
+        return true;
+    }
+
+
+    inline bool test_of_solve() {
+        std::vector v{7, 2, 4, 5, 5, 3, 7, 4, 9};
+        ::ranges::matrix_view m(v, 3, 3, layout::row);
+        // block size 2 exercises the blocked update of the trailing matrix
+        auto lu = algorithms::lu_decomposition::factorize(m, 2).value();
+        assert(close(lu.determinant(), 123.0));
+
+        auto x = lu.solve(std::vector{1, 0, 0});
+        assert(close(x[0], 11.0 / 41) && close(x[1], -8.0 / 41) &&
+               close(x[2], -5.0 / 41));
+
+        auto [inverse_vector, inverse] = lu.inverse();
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                double entry{0.0};
+                for (std::size_t k = 0; k < 3; ++k) {
+                    entry += m[i, k] * inverse[k, j];
+                }
+                assert(close(entry, i == j ? 1.0 : 0.0));
+            }
+        }
+        return true;
+    }
+
+
+    inline void all_test() {
+        assert(test_of_factorization());
+        assert(test_of_solve());
+        std::println("\n\nAll LU Decomposition Tests Passed Succesfully!");
+    }
+}  // namespace tests_of_lu_decomposition
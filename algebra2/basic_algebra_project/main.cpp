@@ -2,9 +2,17 @@
 #include <print>
 
 #include "basic_algebra_2_pack.hpp"
+#include "fixed_matrix.hpp"
+#include "lu_decomposition.hpp"
+#include "modular_elimination.hpp"
+#include "sparse_matrix.hpp"
 
 int main(){
     tests_of_algebra::all_test();
+    tests_of_modular_elimination::all_test();
+    tests_of_lu_decomposition::all_test();
+    tests_of_sparse_matrix::all_test();
+    tests_of_fixed_matrix::all_test();
     examples_of_algebra::examples();
 
     return 0;
@@ -1,14 +1,21 @@
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cerrno>
 #include <charconv>
 #include <concepts>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <expected>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <mdspan>
+#include <optional>
 #include <print>
 #include <ranges>
 #include <span>
@@ -19,9 +26,97 @@
 #include <utility>
 #include <vector>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 
 namespace ranges {
 
+    template <std::ranges::viewable_range R>
+    class numeric_view;
+
+
+    template <typename T>
+    struct is_numeric_view : std::false_type {};
+
+
+    template <typename R>
+    struct is_numeric_view<numeric_view<R>> : std::true_type {};
+
+
+    /*lazy coordinate-wise expressions over rows (numeric_views), e.g.
+     * factor * row_i or row_i - row_j. Nothing is computed until the
+     * expression is applied with += or -= to a numeric_view, which then runs
+     * a single loop over the row without temporaries*/
+    template <typename E>
+    struct is_row_expression : std::false_type {};
+
+
+    template <typename E>
+    concept row_expression = is_row_expression<std::remove_cvref_t<E>>::value;
+
+
+    template <typename E>
+    concept row_operand =
+        row_expression<E> || is_numeric_view<std::remove_cvref_t<E>>::value;
+
+
+    template <typename S>
+    concept row_scalar = !row_operand<S> && !std::ranges::range<S>;
+
+
+    /*scalar * operand, evaluated coordinate by coordinate*/
+    template <row_scalar S, row_operand E>
+    struct scaled_expression {
+        S scalar;
+        E operand;
+
+
+        constexpr auto operator[](std::size_t i) const {
+            return scalar * operand[i];
+        }
+
+
+        constexpr auto size() const -> std::size_t {
+            return static_cast<std::size_t>(std::ranges::size(operand));
+        }
+    };
+
+
+    /*left op right, evaluated coordinate by coordinate*/
+    template <row_operand L, row_operand R, typename Op>
+    struct binary_expression {
+        L left;
+        R right;
+
+
+        constexpr auto operator[](std::size_t i) const {
+            return Op{}(left[i], right[i]);
+        }
+
+
+        constexpr auto size() const -> std::size_t {
+            return static_cast<std::size_t>(std::ranges::size(left));
+        }
+    };
+
+
+    template <typename S, typename E>
+    struct is_row_expression<scaled_expression<S, E>> : std::true_type {};
+
+
+    template <typename L, typename R, typename Op>
+    struct is_row_expression<binary_expression<L, R, Op>> : std::true_type {};
+
+
     /*this class will be used to modify rows columns of a matrix. It vectorizes
      * operations on ranges*/
     template <std::ranges::viewable_range R>
@@ -110,8 +205,59 @@ namespace ranges {
             });
             return *this;
         }
+
+        // Fused coordinate-wise addition of a lazy expression
+        template <row_expression E>
+        constexpr auto operator+=(const E& e) -> auto& {
+            apply(e, [](auto& a, auto b) { a += b; });
+            return *this;
+        }
+
+        // Fused coordinate-wise subtraction of a lazy expression, e.g.
+        // row_k -= factor * row_i
+        template <row_expression E>
+        constexpr auto operator-=(const E& e) -> auto& {
+            apply(e, [](auto& a, auto b) { a -= b; });
+            return *this;
+        }
+
+      private:
+        // single indexed loop, so that it can be vectorized for arithmetic
+        // types
+        template <row_expression E, typename Op>
+        constexpr auto apply(const E& e, Op op) -> void {
+            auto first{this->begin()};
+            const auto n{std::ranges::distance(*this)};
+            for (std::ranges::range_difference_t<R> i = 0; i < n; ++i) {
+                op(first[i], e[static_cast<std::size_t>(i)]);
+            }
+        }
     };
 
+
+    template <row_scalar S, row_operand E>
+    constexpr auto operator*(S scalar, E operand) {
+        return scaled_expression<S, E>{scalar, operand};
+    }
+
+
+    template <row_operand E, row_scalar S>
+    constexpr auto operator*(E operand, S scalar) {
+        return scaled_expression<S, E>{scalar, operand};
+    }
+
+
+    template <row_operand L, row_operand R>
+    constexpr auto operator+(L left, R right) {
+        return binary_expression<L, R, std::plus<>>{left, right};
+    }
+
+
+    template <row_operand L, row_operand R>
+    constexpr auto operator-(L left, R right) {
+        return binary_expression<L, R, std::minus<>>{left, right};
+    }
+
 }  // namespace ranges
 
 
@@ -231,6 +377,116 @@ namespace ranges {
         }
     }
 
+
+    /*side of the square tile below which the recursive copy stops splitting,
+     * 32 x 32 doubles of source and destination fit into the L1 cache*/
+    constexpr std::size_t transpose_tile{32};
+
+
+    /*copies entries [rows_begin, rows_end) x [columns_begin, columns_end) of
+     * source into destination (both have the same shape) by recursively
+     * halving the longer side of the block, so the copy is cache-oblivious
+     * whatever the layouts of source and destination are*/
+    template <typename Source, typename Destination>
+    constexpr auto copy_blocks(Source source,
+                               Destination destination,
+                               std::size_t rows_begin,
+                               std::size_t rows_end,
+                               std::size_t columns_begin,
+                               std::size_t columns_end) -> void {
+        const std::size_t rows{rows_end - rows_begin};
+        const std::size_t columns{columns_end - columns_begin};
+        if (rows <= transpose_tile && columns <= transpose_tile) {
+            for (std::size_t i = rows_begin; i < rows_end; ++i) {
+                for (std::size_t j = columns_begin; j < columns_end; ++j) {
+                    destination[i, j] = source[i, j];
+                }
+            }
+        } else if (rows >= columns) {
+            const std::size_t middle{rows_begin + rows / 2};
+            copy_blocks(source,
+                        destination,
+                        rows_begin,
+                        middle,
+                        columns_begin,
+                        columns_end);
+            copy_blocks(source,
+                        destination,
+                        middle,
+                        rows_end,
+                        columns_begin,
+                        columns_end);
+        } else {
+            const std::size_t middle{columns_begin + columns / 2};
+            copy_blocks(source,
+                        destination,
+                        rows_begin,
+                        rows_end,
+                        columns_begin,
+                        middle);
+            copy_blocks(source,
+                        destination,
+                        rows_begin,
+                        rows_end,
+                        middle,
+                        columns_end);
+        }
+    }
+
+
+    /*returns a copy of m stored in the layout Layout, e.g.
+     * to_layout<std::layout_right>(m) gives a row-major copy. The result is a
+     * pair: data vector and matrix view over it*/
+    template <typename Layout, typename T, typename LP>
+    requires(std::same_as<Layout, std::layout_right> ||
+             std::same_as<Layout, std::layout_left>)
+    auto to_layout(matrix_view<T, LP> m) {
+        using value_type = std::remove_const_t<T>;
+        std::vector<value_type> values(m.number_of_rows() *
+                                       m.number_of_columns());
+        matrix_view<value_type, Layout> result{
+            values, m.number_of_rows(), m.number_of_columns(), Layout{}};
+        if constexpr (std::same_as<Layout, LP>) {
+            std::copy_n(m.data_handle(), values.size(), values.data());
+        } else {
+            copy_blocks(
+                m, result, 0, m.number_of_rows(), 0, m.number_of_columns());
+        }
+        return std::pair{std::move(values), result};
+    }
+
+
+    /*returns a materialized transposition of m with the same layout as m, so
+     * that rows (or columns) of the result are contiguous again. The result is
+     * a pair: data vector and matrix view over it*/
+    template <typename T, typename LP>
+    requires(std::same_as<LP, std::layout_right> ||
+             std::same_as<LP, std::layout_left>)
+    auto transpose_copy(matrix_view<T, LP> m) {
+        return to_layout<LP>(transpose(m));
+    }
+
+
+    /*transposes a square matrix m in place, tile by tile, returns false (and
+     * leaves m untouched) when m is not square*/
+    template <typename T, typename LP>
+    constexpr auto transpose_in_place(matrix_view<T, LP> m) -> bool {
+        const std::size_t n{m.number_of_rows()};
+        if (n != m.number_of_columns()) { return false; }
+        for (std::size_t ib = 0; ib < n; ib += transpose_tile) {
+            const std::size_t i_end{std::min(ib + transpose_tile, n)};
+            for (std::size_t jb = ib; jb < n; jb += transpose_tile) {
+                const std::size_t j_end{std::min(jb + transpose_tile, n)};
+                for (std::size_t i = ib; i < i_end; ++i) {
+                    for (std::size_t j = std::max(jb, i + 1); j < j_end; ++j) {
+                        std::swap(m[i, j], m[j, i]);
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
 }  // namespace ranges
 
 
@@ -352,6 +608,43 @@ namespace utils {
         return out;
     }
 
+    /*bit i of the result is set when chunk[i] is one of the separators,
+     * chunk has to contain size <= 64 characters*/
+    template <char ColumnSeparator, char RowSeparator>
+    inline auto separator_mask(const char* chunk, std::size_t size)
+        -> std::uint64_t {
+        std::uint64_t mask{0};
+        for (std::size_t i = 0; i < size; ++i) {
+            if (chunk[i] == ColumnSeparator || chunk[i] == RowSeparator) {
+                mask |= std::uint64_t{1} << i;
+            }
+        }
+        return mask;
+    }
+
+
+    /*separator_mask for a full block of 64 characters, compares 16 characters
+     * at once with SSE2 when it is available*/
+    template <char ColumnSeparator, char RowSeparator>
+    inline auto separator_mask(const char* chunk) -> std::uint64_t {
+#if defined(__SSE2__)
+        const __m128i column{_mm_set1_epi8(ColumnSeparator)};
+        const __m128i row{_mm_set1_epi8(RowSeparator)};
+        std::uint64_t mask{0};
+        for (std::size_t i = 0; i < 4; ++i) {
+            const __m128i bytes{_mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(chunk + 16 * i))};
+            const auto found{static_cast<std::uint32_t>(
+                _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(bytes, column),
+                                               _mm_cmpeq_epi8(bytes, row))))};
+            mask |= static_cast<std::uint64_t>(found) << (16 * i);
+        }
+        return mask;
+#else
+        return separator_mask<ColumnSeparator, RowSeparator>(chunk, 64);
+#endif
+    }
+
 }  // namespace utils
 
 
@@ -391,44 +684,473 @@ namespace matrix {
     }
 
 
+    /*receives tokens of a text matrix one by one and stores converted values
+     * directly in values, checks that all rows have the same length*/
+    template <typename T, char ColumnSeparator, char RowSeparator>
+    class text_parser {
+      public:
+        explicit text_parser(std::size_t size_hint) : size_hint{size_hint} {}
+
+
+        /*token followed by separator, empty rows are skipped*/
+        auto consume(std::string_view token, char separator) -> void {
+            if (separator == RowSeparator && current_columns == 0 &&
+                is_blank(token)) {
+                return;
+            }
+            values.push_back(utils::from_chars<T>(trim(token)));
+            ++current_columns;
+            if (rows == 0) { first_row_bytes += token.size() + 1; }
+            if (separator == RowSeparator) { finish_row(); }
+        }
+
+
+        /*last token of the input, it has no separator after it*/
+        auto finish(std::string_view token) -> void {
+            if (current_columns != 0 || !is_blank(token)) {
+                consume(token, RowSeparator);
+            }
+        }
+
+
+        [[nodiscard]] auto is_valid() const -> bool { return valid; }
+
+
+        [[nodiscard]] auto result()
+            -> std::tuple<std::vector<T>, std::size_t, std::size_t> {
+            if (!valid) { return {std::vector<T>{}, 0zU, 0zU}; }
+            return {std::move(values), rows, columns};
+        }
+
+      private:
+        static auto is_blank(std::string_view token) -> bool {
+            return trim(token).empty();
+        }
+
+
+        static auto trim(std::string_view token) -> std::string_view {
+            const auto first{token.find_first_not_of(" \t\r\n")};
+            if (first == std::string_view::npos) { return {}; }
+            return token.substr(first,
+                                token.find_last_not_of(" \t\r\n") - first + 1);
+        }
+
+
+        auto finish_row() -> void {
+            if (rows == 0) {
+                columns = current_columns;
+                // the first row tells how many bytes a row takes, which gives
+                // a good estimate of the final number of values
+                if (size_hint != 0) {
+                    values.reserve(size_hint / first_row_bytes * columns +
+                                   columns);
+                }
+            } else if (current_columns != columns) {
+                valid = false;
+            }
+            ++rows;
+            current_columns = 0;
+        }
+
+
+        std::size_t size_hint{};
+        std::vector<T> values{};
+        std::size_t rows{};
+        std::size_t columns{};
+        std::size_t current_columns{};
+        std::size_t first_row_bytes{};
+        bool valid{true};
+    };
+
+
+    /*splits block into tokens and passes them to parser, separators are found
+     * 64 characters at a time. Returns the number of characters of the
+     * unfinished last token, which have to be processed with the next block*/
+    template <typename T, char ColumnSeparator, char RowSeparator>
+    inline auto parse_block(
+        std::string_view block,
+        text_parser<T, ColumnSeparator, RowSeparator>& parser) -> std::size_t {
+        constexpr std::size_t chunk_size{64};
+        std::size_t token_begin{0};
+        for (std::size_t chunk = 0; chunk < block.size(); chunk += chunk_size) {
+            const std::size_t size{std::min(chunk_size, block.size() - chunk)};
+            std::uint64_t mask{
+                size == chunk_size
+                    ? utils::separator_mask<ColumnSeparator, RowSeparator>(
+                          block.data() + chunk)
+                    : utils::separator_mask<ColumnSeparator, RowSeparator>(
+                          block.data() + chunk, size)};
+            while (mask != 0) {
+                const std::size_t separator{
+                    chunk + static_cast<std::size_t>(std::countr_zero(mask))};
+                parser.consume(
+                    block.substr(token_begin, separator - token_begin),
+                    block[separator]);
+                token_begin = separator + 1;
+                mask &= mask - 1;
+            }
+        }
+        return block.size() - token_begin;
+    }
+
+
     /*given a string representing a matrix which separators are column_separator
     and row_separator finds its shape and returns a triple: a vector with values
-    converted to the type T, number of rows, number of columns.*/
+    converted to the type T, number of rows, number of columns. Returns empty
+    vector when rows have different lengths*/
     template <typename T, char ColumnSeparator = ',', char RowSeparator = ';'>
     inline auto to_values_and_shape(std::string_view content)
         -> std::tuple<std::vector<T>, std::size_t, std::size_t> {
-        if (content.empty()) { return {std::vector<T>{}, 0zU, 0zU}; }
-        const auto [rows, cols] =
-            to_shape<T, ColumnSeparator, RowSeparator>(content);
-        std::vector<T> values{};
-        for (auto&& row :
-             content | std::views::split(std::views::single(RowSeparator))) {
-            std::ranges::copy(
-                row | std::views::split(std::views::single(ColumnSeparator)) |
-                    std::views::transform([](auto&& value) {
-                        return utils::from_chars<T>(std::string_view{value});
-                    }),
-                std::back_inserter(values));
-        }
-        return {std::move(values), rows, cols};
+        text_parser<T, ColumnSeparator, RowSeparator> parser{content.size()};
+        const std::size_t rest{parse_block(content, parser)};
+        parser.finish(content.substr(content.size() - rest));
+        return parser.result();
+    }
+
+
+    /*reads a matrix from stream in a single pass, block_size characters at a
+     * time, so the text of the matrix is never held in memory as a whole.
+     * size_hint (e.g. the size of a file) is used to reserve the values*/
+    template <typename T, char ColumnSeparator = ',', char RowSeparator = ';'>
+    inline auto to_values_and_shape(std::istream& stream,
+                                    std::size_t size_hint = 0,
+                                    std::size_t block_size = 1zU << 20U)
+        -> std::tuple<std::vector<T>, std::size_t, std::size_t> {
+        text_parser<T, ColumnSeparator, RowSeparator> parser{size_hint};
+        std::vector<char> buffer(block_size);
+        std::size_t carried{0};
+        while (stream) {
+            if (carried == buffer.size()) { buffer.resize(2 * buffer.size()); }
+            stream.read(buffer.data() + carried,
+                        static_cast<std::streamsize>(buffer.size() - carried));
+            const auto read{static_cast<std::size_t>(stream.gcount())};
+            if (read == 0) { break; }
+            const std::string_view block{buffer.data(), carried + read};
+            const std::size_t rest{parse_block(block, parser)};
+            std::memmove(buffer.data(), block.data() + block.size() - rest, rest);
+            carried = rest;
+        }
+        parser.finish(std::string_view{buffer.data(), carried});
+        return parser.result();
     }
 
 
     /*loads a matrix from a file assuming that this matrix uses separators
     column_separator and row_separator. Moreover, assumes that the entries of
-    this matrix can be converted to type T. Returns a pair: a vector containing
-    values of matrix and the corresponding matrix_view*/
+    this matrix can be converted to type T. The file is parsed in blocks.
+    Returns a pair: a vector containing values of matrix and the corresponding
+    matrix_view*/
     template <typename T, char ColumnSeparator = ',', char RowSeparator = ';'>
     [[nodiscard]] inline auto load(std::filesystem::path file)
         -> std::pair<std::vector<T>,
                      ranges::matrix_view<T, std::layout_right>> {
-        std::string const content{utils::load<char>(std::move(file))};
+        std::error_code ec{};
+        const auto size{std::filesystem::file_size(file, ec)};
+        if (ec) { std::print("file size error: {}\n", ec.message()); }
+        std::ifstream stream(file, std::ios::in | std::ios::binary);
         auto [matrix_values, rows, cols] =
-            to_values_and_shape<T, ColumnSeparator, RowSeparator>(content);
+            to_values_and_shape<T, ColumnSeparator, RowSeparator>(
+                stream, ec ? 0 : static_cast<std::size_t>(size));
 
         ::ranges::matrix_view m{matrix_values, rows, cols, layout::row};
         return {std::move(matrix_values), std::move(m)};
     }
 
 
+    /*binary matrix format: a 64 byte header followed by the raw values in
+     * native byte order, starting at a 64 byte aligned offset, so that a
+     * memory mapped file can be used as a matrix_view without any copy*/
+    namespace binary {
+
+        enum class dtype : std::uint8_t {
+            int8,
+            int16,
+            int32,
+            int64,
+            uint8,
+            uint16,
+            uint32,
+            uint64,
+            float32,
+            float64,
+        };
+
+
+        template <typename T>
+        constexpr auto dtype_of() -> dtype {
+            using U = std::remove_cv_t<T>;
+            if constexpr (std::floating_point<U>) {
+                static_assert(sizeof(U) == 4 || sizeof(U) == 8);
+                return sizeof(U) == 4 ? dtype::float32 : dtype::float64;
+            } else {
+                static_assert(std::integral<U>);
+                constexpr auto width{std::bit_width(sizeof(U)) - 1};
+                return static_cast<dtype>(
+                    (std::signed_integral<U> ? 0 : 4) + width);
+            }
+        }
+
+
+        constexpr std::array<char, 8> magic{
+            'M', 'A', 'T', 'R', 'I', 'X', '\0', '1'};
+        constexpr std::uint64_t data_alignment{64};
+
+
+        struct header {
+            std::array<char, 8> magic{binary::magic};
+            dtype type{};
+            // 0 for std::layout_right, 1 for std::layout_left
+            std::uint8_t layout{};
+            std::array<std::uint8_t, 6> reserved{};
+            std::uint64_t rows{};
+            std::uint64_t columns{};
+            std::uint64_t data_offset{data_alignment};
+            std::array<std::uint8_t, 24> padding{};
+        };
+        static_assert(sizeof(header) == data_alignment);
+
+
+        template <typename T, typename LP>
+        constexpr auto header_of(std::size_t rows, std::size_t columns)
+            -> header {
+            return header{.type = dtype_of<T>(),
+                          .layout = std::same_as<LP, std::layout_right>
+                                        ? std::uint8_t{0}
+                                        : std::uint8_t{1},
+                          .rows = rows,
+                          .columns = columns};
+        }
+
+
+        /*checks that a header read from a file describes a matrix of T in
+         * layout LP*/
+        template <typename T, typename LP>
+        constexpr auto matches(const header& h) -> bool {
+            const header expected{header_of<T, LP>(h.rows, h.columns)};
+            return h.magic == magic && h.type == expected.type &&
+                   h.layout == expected.layout &&
+                   h.data_offset % data_alignment == 0 &&
+                   h.data_offset >= sizeof(header);
+        }
+
+
+        /*offset one past the last value described by h, std::nullopt when
+         * rows * columns * sizeof(T) or the offset itself overflows, so a
+         * corrupted header cannot request a huge allocation or mapping*/
+        template <typename T>
+        constexpr auto data_end(const header& h)
+            -> std::optional<std::uint64_t> {
+            constexpr auto max{std::numeric_limits<std::uint64_t>::max()};
+            if (h.columns != 0 && h.rows > max / sizeof(T) / h.columns) {
+                return std::nullopt;
+            }
+            const std::uint64_t bytes{h.rows * h.columns * sizeof(T)};
+            if (bytes > max - h.data_offset) { return std::nullopt; }
+            return h.data_offset + bytes;
+        }
+
+
+        /*writes a rows x columns matrix to a file piece by piece, values are
+         * appended with write in the storage order of LP, so matrices larger
+         * than memory can be produced. close (or the destructor) reports
+         * whether exactly rows * columns values were written*/
+        template <typename T, typename LP>
+        class writer {
+          public:
+            writer(const std::filesystem::path& file,
+                   std::size_t rows,
+                   std::size_t columns)
+                : expected_values{rows * columns} {
+                if (file.has_parent_path()) {
+                    std::filesystem::create_directories(file.parent_path());
+                }
+                stream = std::fopen(file.c_str(), "wb");
+                if (stream == nullptr) {
+                    std::print("failed to create file {}, reason = {}\n",
+                               file.string(),
+                               std::strerror(errno));
+                    return;
+                }
+                const header h{header_of<T, LP>(rows, columns)};
+                ok = std::fwrite(&h, sizeof(h), 1, stream) == 1;
+            }
+
+
+            writer(const writer&) = delete;
+            auto operator=(const writer&) -> writer& = delete;
+
+
+            ~writer() { close(); }
+
+
+            auto write(std::span<const T> values) -> bool {
+                if (stream == nullptr || !ok) { return false; }
+                ok = std::fwrite(values.data(), sizeof(T), values.size(),
+                                 stream) == values.size();
+                written_values += values.size();
+                return ok;
+            }
+
+
+            auto close() -> bool {
+                if (stream == nullptr) { return false; }
+                ok = std::fclose(stream) == 0 && ok &&
+                     written_values == expected_values;
+                stream = nullptr;
+                return ok;
+            }
+
+          private:
+            std::FILE* stream{nullptr};
+            std::size_t expected_values{};
+            std::size_t written_values{};
+            bool ok{false};
+        };
+
+
+        /*read-only memory mapping of a binary matrix file, owns the mapping
+         * and exposes the values as a matrix_view without copying them*/
+        template <typename T, typename LP>
+        class mapped_matrix {
+          public:
+            mapped_matrix(mapped_matrix&& other) noexcept
+                : address{std::exchange(other.address, nullptr)},
+                  length{std::exchange(other.length, 0)},
+                  h{other.h} {}
+
+
+            auto operator=(mapped_matrix&& other) noexcept -> mapped_matrix& {
+                std::swap(address, other.address);
+                std::swap(length, other.length);
+                std::swap(h, other.h);
+                return *this;
+            }
+
+
+            ~mapped_matrix() {
+#if defined(__unix__) || defined(__APPLE__)
+                if (address != nullptr) { ::munmap(address, length); }
+#endif
+            }
+
+
+            [[nodiscard]] auto view() const
+                -> ranges::matrix_view<const T, LP> {
+                return {reinterpret_cast<const T*>(
+                            static_cast<const char*>(address) + h.data_offset),
+                        h.rows,
+                        h.columns,
+                        LP{}};
+            }
+
+
+            /*opens and maps file, fails when it is not a binary matrix of T
+             * in layout LP*/
+            static auto open(const std::filesystem::path& file)
+                -> std::expected<mapped_matrix, std::error_code> {
+#if defined(__unix__) || defined(__APPLE__)
+                const int descriptor{::open(file.c_str(), O_RDONLY)};
+                if (descriptor < 0) {
+                    return std::unexpected(
+                        std::error_code{errno, std::generic_category()});
+                }
+                struct ::stat status {};
+                if (::fstat(descriptor, &status) != 0 ||
+                    static_cast<std::size_t>(status.st_size) < sizeof(header)) {
+                    ::close(descriptor);
+                    return std::unexpected(
+                        std::make_error_code(std::errc::invalid_argument));
+                }
+                const auto size{static_cast<std::size_t>(status.st_size)};
+                void* address{
+                    ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0)};
+                ::close(descriptor);
+                if (address == MAP_FAILED) {
+                    return std::unexpected(
+                        std::error_code{errno, std::generic_category()});
+                }
+                mapped_matrix result{address, size};
+                const auto end{data_end<T>(result.h)};
+                if (!matches<T, LP>(result.h) || !end || *end > size) {
+                    return std::unexpected(
+                        std::make_error_code(std::errc::invalid_argument));
+                }
+                return result;
+#else
+                return std::unexpected(
+                    std::make_error_code(std::errc::not_supported));
+#endif
+            }
+
+          private:
+            mapped_matrix(void* address, std::size_t length)
+                : address{address}, length{length} {
+                std::memcpy(&h, address, sizeof(h));
+            }
+
+
+            void* address{nullptr};
+            std::size_t length{};
+            header h{};
+        };
+
+    }  // namespace binary
+
+
+    /*saves a matrix m to file in the binary format, the values are written in
+     * the storage order of m*/
+    template <typename T, typename LP>
+    inline auto save_binary(ranges::matrix_view<T, LP> m,
+                            const std::filesystem::path& file) -> bool {
+        using value_type = std::remove_const_t<T>;
+        binary::writer<value_type, LP> out{
+            file, m.number_of_rows(), m.number_of_columns()};
+        out.write(std::span<const value_type>{
+            m.data_handle(), m.number_of_rows() * m.number_of_columns()});
+        return out.close();
+    }
+
+
+    /*maps a binary matrix file into memory, zero-copy, see
+     * binary::mapped_matrix*/
+    template <typename T, typename LP = std::layout_right>
+    [[nodiscard]] inline auto map_binary(const std::filesystem::path& file) {
+        return binary::mapped_matrix<T, LP>::open(file);
+    }
+
+
+    /*loads a binary matrix file into a vector, works without mmap. Returns a
+     * pair: a vector containing values of matrix and the corresponding
+     * matrix_view, both empty when the file is not a binary matrix of T in
+     * layout LP*/
+    template <typename T, typename LP = std::layout_right>
+    [[nodiscard]] inline auto load_binary(const std::filesystem::path& file)
+        -> std::pair<std::vector<T>, ranges::matrix_view<T, LP>> {
+        std::vector<T> values{};
+        auto rejected = [&] {
+            std::print("{} is not a binary matrix of the requested type\n",
+                       file.string());
+            values.clear();
+            ranges::matrix_view<T, LP> empty{values, 0, 0, LP{}};
+            return std::pair{std::move(values), empty};
+        };
+        std::ifstream stream(file, std::ios::in | std::ios::binary);
+        binary::header h{};
+        stream.read(reinterpret_cast<char*>(&h), sizeof(h));
+        if (!stream || !binary::matches<T, LP>(h)) { return rejected(); }
+        std::error_code ec;
+        const auto size{std::filesystem::file_size(file, ec)};
+        const auto end{binary::data_end<T>(h)};
+        if (ec || !end || *end > size) { return rejected(); }
+        values.resize(h.rows * h.columns);
+        const auto bytes{
+            static_cast<std::streamsize>(values.size() * sizeof(T))};
+        stream.seekg(static_cast<std::streamoff>(h.data_offset));
+        stream.read(reinterpret_cast<char*>(values.data()), bytes);
+        if (!stream || stream.gcount() != bytes) { return rejected(); }
+        ranges::matrix_view<T, LP> m{values, h.rows, h.columns, LP{}};
+        return {std::move(values), m};
+    }
+
+
 }  // namespace matrix
\ No newline at end of file
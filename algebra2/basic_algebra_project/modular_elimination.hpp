@@ -0,0 +1,723 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <expected>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../../big_integer.hpp"
+#include "gaussian_elimination.hpp"
+
+
+namespace algorithms::modular_elimination {
+
+    using gaussian_elimination::fraction;
+    using number_theory::big_integer;
+
+    using residue_t = std::uint32_t;
+
+
+    enum class error : std::uint8_t {
+        not_invertible,
+        not_square,
+        not_reconstructible,
+        size_mismatch,
+    };
+
+
+    /*
+        description:
+            arithmetic modulo an odd prime p < 2^31 with Montgomery reduction
+       (R = 2^32). Residues passed to add, subtract, multiply and inverse are
+       kept in Montgomery form, that is x * R mod p
+    */
+    struct montgomery {
+        residue_t p{};
+        residue_t p_neg_inv{};
+        residue_t r_squared{};
+
+
+        constexpr explicit montgomery(residue_t modulus) : p{modulus} {
+            // Newton iteration doubles the number of correct low bits of
+            // p^-1 mod 2^32, p * p = 1 mod 8 gives the first 3 of them
+            residue_t inv{modulus};
+            for (int i = 0; i < 4; ++i) { inv *= 2U - modulus * inv; }
+            p_neg_inv = ~inv + 1U;
+            // R^2 = 2^64 = (2^64 - 1) + 1
+            r_squared = static_cast<residue_t>(
+                ((~std::uint64_t{0} % modulus) + 1U) % modulus);
+        }
+
+
+        /*
+            description:
+                returns t * R^-1 mod p for t < p * 2^32
+        */
+        [[nodiscard]] constexpr auto reduce(std::uint64_t t) const
+            -> residue_t {
+            const residue_t m{static_cast<residue_t>(t) * p_neg_inv};
+            const auto u{static_cast<residue_t>(
+                (t + static_cast<std::uint64_t>(m) * p) >> 32U)};
+            return u >= p ? u - p : u;
+        }
+
+
+        [[nodiscard]] constexpr auto to_montgomery(std::uint64_t x) const
+            -> residue_t {
+            return reduce(static_cast<std::uint64_t>(x % p) * r_squared);
+        }
+
+
+        [[nodiscard]] constexpr auto from_montgomery(residue_t x) const
+            -> residue_t {
+            return reduce(x);
+        }
+
+
+        [[nodiscard]] constexpr auto one() const -> residue_t {
+            return to_montgomery(1);
+        }
+
+
+        [[nodiscard]] constexpr auto add(residue_t a, residue_t b) const
+            -> residue_t {
+            const residue_t sum{a + b};
+            return sum >= p ? sum - p : sum;
+        }
+
+
+        [[nodiscard]] constexpr auto subtract(residue_t a, residue_t b) const
+            -> residue_t {
+            return a >= b ? a - b : a + p - b;
+        }
+
+
+        [[nodiscard]] constexpr auto negate(residue_t a) const -> residue_t {
+            return a == 0 ? 0 : p - a;
+        }
+
+
+        [[nodiscard]] constexpr auto multiply(residue_t a, residue_t b) const
+            -> residue_t {
+            return reduce(static_cast<std::uint64_t>(a) * b);
+        }
+
+
+        [[nodiscard]] constexpr auto pow(residue_t base,
+                                         std::uint64_t exponent) const
+            -> residue_t {
+            residue_t result{one()};
+            while (exponent > 0) {
+                if (exponent % 2 == 1) { result = multiply(result, base); }
+                base = multiply(base, base);
+                exponent /= 2;
+            }
+            return result;
+        }
+
+
+        /*
+            description:
+                inverse of a non-zero residue by Fermat's little theorem
+        */
+        [[nodiscard]] constexpr auto inverse(residue_t a) const -> residue_t {
+            return pow(a, p - 2);
+        }
+    };
+
+
+    /*
+        description:
+            deterministic Miller-Rabin test for odd n < 2^31, the bases 2, 7
+       and 61 are enough for every n < 4759123141
+    */
+    constexpr auto is_prime(residue_t n) -> bool {
+        constexpr std::array<residue_t, 3> bases{2U, 7U, 61U};
+        if (std::ranges::contains(bases, n)) { return true; }
+        const montgomery mont{n};
+        const residue_t one{mont.one()};
+        const residue_t minus_one{mont.negate(one)};
+        const int twos{std::countr_zero(n - 1U)};
+        for (const residue_t base : bases) {
+            residue_t x{mont.pow(mont.to_montgomery(base), (n - 1U) >> twos)};
+            if (x == one) { continue; }
+            for (int i = 1; i < twos && x != minus_one; ++i) {
+                x = mont.multiply(x, x);
+            }
+            if (x != minus_one) { return false; }
+        }
+        return true;
+    }
+
+
+    /*
+        description:
+            the count largest primes p < 2^31 in decreasing order, used by the
+       multi-modular algorithms. Keeping p < 2^31 lets the sum of two residues
+       fit into residue_t, and there are about 5 * 10^7 primes above 2^30, so
+       each of them adds at least 30 bits to the product
+    */
+    inline auto primes(std::size_t count) -> std::vector<residue_t> {
+        std::vector<residue_t> result{};
+        result.reserve(count);
+        for (residue_t candidate = (residue_t{1} << 31U) - 1U;
+             result.size() < count;
+             candidate -= 2) {
+            if (is_prime(candidate)) { result.push_back(candidate); }
+        }
+        return result;
+    }
+
+
+    /*
+        description:
+            maps an integer to its residue modulo p in Montgomery form
+    */
+    template <std::integral T>
+    constexpr auto to_residue(T value, const montgomery& mont) -> residue_t {
+        if constexpr (std::is_signed_v<T>) {
+            auto r{static_cast<std::int64_t>(value) %
+                   static_cast<std::int64_t>(mont.p)};
+            if (r < 0) { r += mont.p; }
+            return mont.to_montgomery(static_cast<std::uint64_t>(r));
+        } else {
+            return mont.to_montgomery(static_cast<std::uint64_t>(value));
+        }
+    }
+
+
+    /*
+        description:
+            subtracts factor * source from target, both being (parts of) rows
+       of a flat array of residues
+    */
+    inline auto subtract_row(std::span<residue_t> target,
+                             std::span<const residue_t> source,
+                             residue_t factor,
+                             const montgomery& mont) -> void {
+        for (std::size_t j = 0; j < target.size(); ++j) {
+            target[j] =
+                mont.subtract(target[j], mont.multiply(factor, source[j]));
+        }
+    }
+
+
+    /*
+        description:
+            eliminates the first pivot_columns columns of a flat, row-major
+       rows x cols array of Montgomery residues. With reduce_above the result
+       is the reduced (diagonal) form with ones on the diagonal, otherwise only
+       the echelon form is produced. Returns the determinant of the leading
+       pivot_columns x pivot_columns block in Montgomery form, zero when it is
+       singular (the elimination stops at the first missing pivot)
+    */
+    inline auto eliminate(std::span<residue_t> a,
+                          std::size_t cols,
+                          std::size_t pivot_columns,
+                          const montgomery& mont,
+                          bool reduce_above) -> residue_t {
+        const std::size_t rows{a.size() / cols};
+        auto row = [&](std::size_t i, std::size_t from) {
+            return a.subspan(i * cols + from, cols - from);
+        };
+        residue_t det{mont.one()};
+        for (std::size_t col = 0; col < pivot_columns; ++col) {
+            std::size_t pivot_row{col};
+            while (pivot_row < rows && a[pivot_row * cols + col] == 0) {
+                ++pivot_row;
+            }
+            if (pivot_row == rows) { return 0; }
+            if (pivot_row != col) {
+                std::ranges::swap_ranges(row(pivot_row, col), row(col, col));
+                det = mont.negate(det);
+            }
+            const residue_t pivot{a[col * cols + col]};
+            const residue_t pivot_inverse{mont.inverse(pivot)};
+            det = mont.multiply(det, pivot);
+            if (reduce_above) {
+                for (auto& value : row(col, col)) {
+                    value = mont.multiply(value, pivot_inverse);
+                }
+            }
+            for (std::size_t i = reduce_above ? 0 : col + 1; i < rows; ++i) {
+                const residue_t entry{a[i * cols + col]};
+                if (i == col || entry == 0) { continue; }
+                const residue_t factor{
+                    reduce_above ? entry
+                                 : mont.multiply(entry, pivot_inverse)};
+                subtract_row(row(i, col), row(col, col), factor, mont);
+            }
+        }
+        return det;
+    }
+
+
+    /*
+        description:
+            reduces matrix m (and optionally a right-hand side y appended as
+       the last column) modulo p into a flat row-major array of Montgomery
+       residues
+    */
+    template <std::integral T, typename LP>
+    auto to_residues(ranges::matrix_view<T, LP> m,
+                     std::span<const T> y,
+                     const montgomery& mont) -> std::vector<residue_t> {
+        const std::size_t cols{m.number_of_columns() + (y.empty() ? 0 : 1)};
+        std::vector<residue_t> residues(m.number_of_rows() * cols);
+        for (std::size_t i = 0; i < m.number_of_rows(); ++i) {
+            for (std::size_t j = 0; j < m.number_of_columns(); ++j) {
+                residues[i * cols + j] = to_residue(m[i, j], mont);
+            }
+            if (!y.empty()) { residues[i * cols + cols - 1] = to_residue(y[i], mont); }
+        }
+        return residues;
+    }
+
+
+    /*
+        description:
+            runs task(k) for k = 0, ..., number_of_tasks - 1 on at most
+       std::thread::hardware_concurrency() threads, thread w taking the tasks
+       w, w + threads, w + 2 * threads, ..., and waits for all of them
+    */
+    template <typename Task>
+    auto run_in_parallel(std::size_t number_of_tasks, Task task) -> void {
+        const std::size_t threads{std::min<std::size_t>(
+            number_of_tasks, std::max(1U, std::thread::hardware_concurrency()))};
+        std::vector<std::jthread> workers;
+        workers.reserve(threads);
+        for (std::size_t w = 0; w < threads; ++w) {
+            workers.emplace_back([&task, w, threads, number_of_tasks] {
+                for (std::size_t k = w; k < number_of_tasks; k += threads) {
+                    task(k);
+                }
+            });
+        }
+    }
+
+
+    /*
+        description:
+            Garner's form of the Chinese remainder theorem for distinct primes
+       p_0, ..., p_(n-1). The mixed radix digits v_k of
+       x = v_0 + v_1 * p_0 + v_2 * p_0 * p_1 + ... are found in machine words
+       and only the final sum is a big_integer. The inverses of
+       p_0 * ... * p_(k-1) modulo p_k are computed once and shared by all the
+       values reconstructed from the same primes
+    */
+    struct chinese_remainder {
+        std::vector<residue_t> moduli{};
+        std::vector<residue_t> inverses{};
+        big_integer modulus{1};
+
+
+        explicit chinese_remainder(std::span<const residue_t> primes)
+            : moduli(std::ranges::begin(primes), std::ranges::end(primes)),
+              inverses(primes.size()) {
+            for (std::size_t k = 0; k < moduli.size(); ++k) {
+                const std::uint64_t p{moduli[k]};
+                std::uint64_t product{1};
+                for (std::size_t j = 0; j < k; ++j) {
+                    product = product * moduli[j] % p;
+                }
+                const montgomery mont{moduli[k]};
+                inverses[k] = mont.from_montgomery(
+                    mont.inverse(mont.to_montgomery(product)));
+                modulus *= moduli[k];
+            }
+        }
+
+
+        /*
+            description:
+                returns x (0 <= x < M) with x = residues[k] mod p_k and
+           M = p_0 * ... * p_(n-1)
+        */
+        [[nodiscard]] auto operator()(std::span<const residue_t> residues) const
+            -> big_integer {
+            std::vector<residue_t> digits(moduli.size());
+            for (std::size_t k = 0; k < moduli.size(); ++k) {
+                const std::uint64_t p{moduli[k]};
+                std::uint64_t partial{0};
+                for (std::size_t j = k; j-- > 0;) {
+                    partial = (partial * moduli[j] + digits[j]) % p;
+                }
+                digits[k] = static_cast<residue_t>(
+                    (residues[k] + p - partial) % p * inverses[k] % p);
+            }
+            big_integer x{0};
+            for (std::size_t k = moduli.size(); k-- > 0;) {
+                x *= moduli[k];
+                x += digits[k];
+            }
+            return x;
+        }
+    };
+
+
+    /*
+        description:
+            maps x (0 <= x < M) to the symmetric range (-M/2, M/2]
+    */
+    inline auto symmetric(big_integer x, const big_integer& modulus)
+        -> big_integer {
+        if ((x << 1U) > modulus) { x -= modulus; }
+        return x;
+    }
+
+
+    /*
+        description:
+            rational reconstruction (Wang's algorithm). Finds n/d in lowest
+       terms with n = x * d mod M and |n|, d <= sqrt(M / 2), returns
+       std::nullopt when there is no such fraction
+    */
+    inline auto rational_reconstruction(const big_integer& x,
+                                        const big_integer& modulus)
+        -> std::optional<fraction<big_integer>> {
+        // r <= sqrt(M / 2) is the same as 2 * r^2 <= M
+        auto within_bound = [&](const big_integer& r) {
+            return ((r * r) << 1U) <= modulus;
+        };
+        big_integer r0{modulus};
+        big_integer r1{x % modulus};
+        big_integer t0{0};
+        big_integer t1{1};
+        while (!within_bound(r1)) {
+            const big_integer q{r0 / r1};
+            r0 = std::exchange(r1, r0 - q * r1);
+            t0 = std::exchange(t1, t0 - q * t1);
+        }
+        const big_integer denominator{abs(t1)};
+        if (!denominator || !within_bound(denominator)) { return std::nullopt; }
+        fraction<big_integer> result{t1.is_negative() ? -r1 : r1, denominator};
+        result.reduce();
+        if (result.denominator != denominator) { return std::nullopt; }
+        return result;
+    }
+
+
+    /*
+        description:
+            log2 of the Hadamard bound prod_i |row_i| of matrix m, each row
+       extended by y[i] when y is not empty. With y it bounds both |det m| and
+       the determinant of m with any column replaced by y (Cramer's rule).
+       Zero rows are skipped, the bound stays an upper bound
+    */
+    template <std::integral T, typename LP>
+    auto hadamard_bits(ranges::matrix_view<T, LP> m, std::span<const T> y)
+        -> double {
+        double bits{0.0};
+        for (std::size_t i = 0; i < m.number_of_rows(); ++i) {
+            double squares{0.0};
+            for (std::size_t j = 0; j < m.number_of_columns(); ++j) {
+                const auto entry{static_cast<double>(m[i, j])};
+                squares += entry * entry;
+            }
+            if (!y.empty()) {
+                const auto entry{static_cast<double>(y[i])};
+                squares += entry * entry;
+            }
+            if (squares > 0.0) { bits += 0.5 * std::log2(squares); }
+        }
+        return bits;
+    }
+
+
+    /*
+        description:
+            number of primes above 2^30 whose product exceeds 2^bits
+    */
+    inline auto primes_for_bits(double bits) -> std::size_t {
+        constexpr double bits_per_prime{30.0};
+        const auto needed{
+            static_cast<std::size_t>(std::ceil(bits / bits_per_prime))};
+        return std::max(std::size_t{1}, needed);
+    }
+
+
+    /*
+        description:
+            checks coefficients * x == y exactly. The fractions are brought to
+       their common denominator and every row is summed in big_integer
+       arithmetic
+    */
+    template <std::integral T, typename LP>
+    auto satisfies(ranges::matrix_view<T, LP> coefficients,
+                   std::span<const T> y,
+                   std::span<const fraction<big_integer>> x) -> bool {
+        big_integer common{1};
+        for (const auto& value : x) {
+            common = common / gcd(common, value.denominator) * value.denominator;
+        }
+        std::vector<big_integer> scaled(x.size());
+        for (std::size_t j = 0; j < x.size(); ++j) {
+            scaled[j] = x[j].numerator * (common / x[j].denominator);
+        }
+        for (std::size_t i = 0; i < coefficients.number_of_rows(); ++i) {
+            big_integer sum{0};
+            for (std::size_t j = 0; j < x.size(); ++j) {
+                sum += big_integer{coefficients[i, j]} * scaled[j];
+            }
+            if (sum != big_integer{y[i]} * common) { return false; }
+        }
+        return true;
+    }
+
+
+    /*
+        description:
+            calculates the exact determinant of an integer matrix m. The
+       elimination is performed independently modulo several primes in
+       parallel and the result is reconstructed with the Chinese remainder
+       theorem. The Hadamard bound decides how many primes are generated, so
+       the determinant has no size limit
+    */
+    template <std::integral T, typename LP>
+    auto determinant(ranges::matrix_view<T, LP> m)
+        -> std::expected<big_integer, error> {
+        if (m.number_of_rows() != m.number_of_columns()) {
+            return std::unexpected(error::not_square);
+        }
+        const std::size_t n{m.number_of_rows()};
+        const auto moduli{primes(
+            primes_for_bits(1.0 + hadamard_bits(m, std::span<const T>{})))};
+        std::vector<residue_t> dets(moduli.size());
+        run_in_parallel(moduli.size(), [&](std::size_t k) {
+            const montgomery mont{moduli[k]};
+            auto residues{to_residues(m, std::span<const T>{}, mont)};
+            dets[k] = mont.from_montgomery(
+                eliminate(residues, n, n, mont, false));
+        });
+        const chinese_remainder crt{moduli};
+        return symmetric(crt(dets), crt.modulus);
+    }
+
+
+    /*
+        description:
+            solves the square system coefficients * x = y exactly. Each prime
+       solves the system modulo p by Gauss-Jordan elimination on a flat array
+       (in parallel), the solutions are combined with the Chinese remainder
+       theorem and turned into fractions by rational reconstruction. The
+       number of primes comes from the Hadamard bound of the numerators and
+       the denominator given by Cramer's rule, primes for which the system
+       happens to be singular are replaced by spare ones. The fractions are
+       checked against the system before they are returned
+    */
+    template <std::integral T, typename LP>
+    auto solve(ranges::matrix_view<T, LP> coefficients,
+               std::ranges::range auto y)
+        -> std::expected<std::vector<fraction<big_integer>>, error> {
+        if (coefficients.number_of_rows() !=
+            coefficients.number_of_columns()) {
+            return std::unexpected(error::not_square);
+        }
+        const std::size_t n{coefficients.number_of_rows()};
+        const std::vector<T> rhs(std::ranges::begin(y), std::ranges::end(y));
+        if (rhs.size() != n) { return std::unexpected(error::size_mismatch); }
+        // rational reconstruction needs M > 2 * N * D with |N|, D <= bound
+        const std::size_t needed{primes_for_bits(
+            1.0 + 2.0 * hadamard_bits(coefficients, std::span{rhs}))};
+        // the system is singular modulo p only when p divides the
+        // determinant, which has less than needed * 30 / 2 bits, so an
+        // invertible matrix loses at most needed / 2 of the candidates
+        const auto candidates{primes(2 * needed)};
+
+        std::vector<std::vector<residue_t>> solutions(candidates.size());
+        auto solve_modulo = [&](std::size_t k) {
+            const montgomery mont{candidates[k]};
+            auto residues{to_residues(coefficients, std::span{rhs}, mont)};
+            if (eliminate(residues, n + 1, n, mont, true) == 0) { return; }
+            solutions[k].resize(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                solutions[k][i] = mont.from_montgomery(residues[i * (n + 1) + n]);
+            }
+        };
+        run_in_parallel(needed, solve_modulo);
+        auto solved = [](const auto& solution) { return !solution.empty(); };
+        if (std::ranges::count_if(std::span{solutions}.first(needed), solved) <
+            static_cast<std::ptrdiff_t>(needed)) {
+            run_in_parallel(candidates.size() - needed, [&](std::size_t k) {
+                solve_modulo(needed + k);
+            });
+        }
+        std::vector<residue_t> lucky_primes{};
+        for (std::size_t k = 0; k < candidates.size(); ++k) {
+            if (solved(solutions[k])) { lucky_primes.push_back(candidates[k]); }
+        }
+        if (lucky_primes.size() < needed) {
+            return std::unexpected(error::not_invertible);
+        }
+
+        const chinese_remainder crt{lucky_primes};
+        std::vector<fraction<big_integer>> result{};
+        result.reserve(n);
+        std::vector<residue_t> residues{};
+        for (std::size_t i = 0; i < n; ++i) {
+            residues.clear();
+            for (const auto& solution : solutions) {
+                if (solved(solution)) { residues.push_back(solution[i]); }
+            }
+            auto value{rational_reconstruction(crt(residues), crt.modulus)};
+            if (!value) { return std::unexpected(error::not_reconstructible); }
+            result.push_back(std::move(*value));
+        }
+        if (!satisfies(coefficients, std::span<const T>{rhs},
+                       std::span<const fraction<big_integer>>{result})) {
+            return std::unexpected(error::not_reconstructible);
+        }
+        return result;
+    }
+
+}  // namespace algorithms::modular_elimination
+
+
+namespace tests_of_modular_elimination {
+
+    inline bool test_of_montgomery() {
+        using namespace algorithms::modular_elimination;
+        const residue_t p{primes(1)[0]};
+        const montgomery mont{p};
+        const residue_t a{mont.to_montgomery(123456789)};
+        const residue_t b{mont.to_montgomery(987654321)};
+        assert(mont.from_montgomery(mont.multiply(a, b)) ==
+               (123456789ULL * 987654321ULL) % p);
+        assert(mont.from_montgomery(mont.multiply(a, mont.inverse(a))) == 1);
+        return true;
+    }
+
+
+    inline bool test_of_primes() {
+        using namespace algorithms::modular_elimination;
+        assert((primes(4) == std::vector<residue_t>{
+                                 2147483647U, 2147483629U, 2147483587U,
+                                 2147483579U}));
+        // strong pseudoprimes to the base 2 and to the bases 2, 3 and 5
+        assert(!is_prime(2047U));
+        assert(!is_prime(25326001U));
+        assert(is_prime(61U) && is_prime(1'000'000'007U));
+        return true;
+    }
+
+
+    /*
+        description:
+            n x n matrix L * U with entries near 10^6, L unit lower triangular
+       and U upper triangular with 10^6 + i on its diagonal, so the
+       determinant is the product of 10^6 + i
+    */
+    inline auto large_matrix(std::size_t n) -> std::vector<std::int64_t> {
+        std::vector<std::int64_t> lower(n * n, 0);
+        std::vector<std::int64_t> upper(n * n, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            lower[i * n + i] = 1;
+            for (std::size_t j = 0; j < i; ++j) {
+                lower[i * n + j] = static_cast<std::int64_t>((i + j) % 3);
+            }
+            upper[i * n + i] = 1'000'000 + static_cast<std::int64_t>(i);
+            for (std::size_t j = i + 1; j < n; ++j) {
+                upper[i * n + j] =
+                    1'000'000 + static_cast<std::int64_t>(i * j % 97);
+            }
+        }
+        std::vector<std::int64_t> product(n * n, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t k = 0; k < n; ++k) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    product[i * n + j] += lower[i * n + k] * upper[k * n + j];
+                }
+            }
+        }
+        return product;
+    }
+
+
+    inline bool test_of_determinant() {
+        using number_theory::big_integer;
+        std::vector v{7, 2, 4, 5, 5, 3, 7, 4, 9};
+        ::ranges::matrix_view m(v, 3, 3, layout::row);
+        auto det = algorithms::modular_elimination::determinant(m);
+        assert(det.has_value() && *det == 123);
+
+        std::vector singular{1, 2, 3, 4, 5, 6, 7, 8, 9};
+        ::ranges::matrix_view s(singular, 3, 3, layout::row);
+        assert(algorithms::modular_elimination::determinant(s).value() == 0);
+
+        // the Hadamard bound of a 40 x 40 matrix with entries near 10^6 needs
+        // about 30 primes, the determinant itself has 240 digits
+        auto large{large_matrix(40)};
+        ::ranges::matrix_view l(large, 40, 40, layout::row);
+        big_integer expected{1};
+        for (int i = 0; i < 40; ++i) { expected *= 1'000'000 + i; }
+        assert(algorithms::modular_elimination::determinant(l).value() ==
+               expected);
+        return true;
+    }
+
+
+    inline bool test_of_solve() {
+        using algorithms::gaussian_elimination::fraction;
+        using number_theory::big_integer;
+        std::vector v{7, 2, 4, 5, 5, 3, 7, 4, 9};
+        std::vector y{1, 0, 0};
+        ::ranges::matrix_view m(v, 3, 3, layout::row);
+        auto x = algorithms::modular_elimination::solve(m, y);
+        assert(x.has_value());
+        assert((x.value() == std::vector<fraction<big_integer>>{
+                                 {11, 41}, {-8, 41}, {-5, 41}}));
+
+        std::vector singular{1, 2, 2, 4};
+        ::ranges::matrix_view s(singular, 2, 2, layout::row);
+        assert(algorithms::modular_elimination::solve(s, std::vector{1, 1})
+                   .error() ==
+               algorithms::modular_elimination::error::not_invertible);
+
+        assert(algorithms::modular_elimination::solve(m, std::vector{1, 0})
+                   .error() ==
+               algorithms::modular_elimination::error::size_mismatch);
+
+        // about 60 primes, y = l * (j - 20) gives back the integers j - 20
+        constexpr std::size_t n{40};
+        auto large{large_matrix(n)};
+        ::ranges::matrix_view l(large, n, n, layout::row);
+        std::vector<std::int64_t> rhs(n, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                rhs[i] += large[i * n + j] * (static_cast<std::int64_t>(j) - 20);
+            }
+        }
+        auto solution = algorithms::modular_elimination::solve(l, rhs);
+        assert(solution.has_value() && solution->size() == n);
+        for (std::size_t j = 0; j < n; ++j) {
+            assert(((*solution)[j] ==
+                    fraction<big_integer>{static_cast<std::int64_t>(j) - 20, 1}));
+        }
+
+        // a fraction whose denominator, the determinant, needs many primes
+        rhs.assign(n, 0);
+        rhs[0] = 1;
+        auto column = algorithms::modular_elimination::solve(l, rhs);
+        assert(column.has_value());
+        return true;
+    }
+
+
+    inline void all_test() {
+        assert(test_of_montgomery());
+        assert(test_of_primes());
+        assert(test_of_determinant());
+        assert(test_of_solve());
+        std::println("\n\nAll Modular Elimination Tests Passed Succesfully!");
+    }
+}  // namespace tests_of_modular_elimination
@@ -0,0 +1,559 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gaussian_elimination.hpp"
+
+
+namespace algebra::sparse {
+
+    using algorithms::gaussian_elimination::error;
+
+    // column (CSR) or row (CSC) index of a stored entry, 32 bits keep the
+    // index array half the size of std::size_t
+    using index_t = std::uint32_t;
+
+
+    /*
+        description:
+            compressed sparse matrix. With std::layout_right it is stored row
+       by row (CSR): entries offsets[i], ..., offsets[i + 1] - 1 of indices and
+       values are the columns and values of row i. With std::layout_left it is
+       stored column by column (CSC) and indices holds rows
+    */
+    template <typename T, typename LP>
+    requires(std::same_as<LP, std::layout_right> ||
+             std::same_as<LP, std::layout_left>)
+    struct compressed_matrix {
+        std::size_t rows{};
+        std::size_t columns{};
+        std::vector<std::size_t> offsets{0};
+        std::vector<index_t> indices{};
+        std::vector<T> values{};
+
+
+        [[nodiscard]] constexpr auto number_of_rows() const -> std::size_t {
+            return rows;
+        }
+
+
+        [[nodiscard]] constexpr auto number_of_columns() const
+            -> std::size_t {
+            return columns;
+        }
+
+
+        [[nodiscard]] constexpr auto non_zeros() const -> std::size_t {
+            return values.size();
+        }
+
+
+        // number of rows for CSR, number of columns for CSC
+        [[nodiscard]] constexpr auto major_extent() const -> std::size_t {
+            return std::same_as<LP, std::layout_right> ? rows : columns;
+        }
+    };
+
+
+    template <typename T>
+    using csr_matrix = compressed_matrix<T, std::layout_right>;
+
+
+    template <typename T>
+    using csc_matrix = compressed_matrix<T, std::layout_left>;
+
+
+    /*
+        description:
+            runs task(begin, end) on consecutive chunks of [0, count), one
+       chunk per hardware thread. Small inputs are processed on the calling
+       thread
+    */
+    template <typename Task>
+    inline auto for_each_chunk(std::size_t count, Task task) -> void {
+        constexpr std::size_t minimal_chunk{256};
+        const std::size_t threads{std::clamp<std::size_t>(
+            count / minimal_chunk,
+            1,
+            std::max(1U, std::thread::hardware_concurrency()))};
+        if (threads == 1) {
+            task(std::size_t{0}, count);
+            return;
+        }
+        const std::size_t chunk{(count + threads - 1) / threads};
+        std::vector<std::jthread> workers;
+        workers.reserve(threads);
+        for (std::size_t begin = 0; begin < count; begin += chunk) {
+            workers.emplace_back(task, begin, std::min(begin + chunk, count));
+        }
+    }
+
+
+    /*
+        description:
+            throws std::length_error when rows or columns do not fit in
+       index_t. Either extent ends up in indices once the matrix is converted
+       between CSR and CSC, so both are checked
+    */
+    inline auto check_extents(std::size_t rows, std::size_t columns) -> void {
+        constexpr std::size_t limit{std::numeric_limits<index_t>::max()};
+        if (rows > limit || columns > limit) {
+            throw std::length_error(
+                "sparse matrix extents must not exceed UINT32_MAX");
+        }
+    }
+
+
+    /*
+        description:
+            compresses matrix m into layout Layout, entries equal to T{} are
+       not stored. Extents above UINT32_MAX throw std::length_error
+    */
+    template <typename Layout, typename T, typename LP>
+    auto to_compressed(::ranges::matrix_view<T, LP> m)
+        -> compressed_matrix<std::remove_const_t<T>, Layout> {
+        check_extents(m.number_of_rows(), m.number_of_columns());
+        compressed_matrix<std::remove_const_t<T>, Layout> result{
+            .rows = m.number_of_rows(), .columns = m.number_of_columns()};
+        constexpr bool by_rows{std::same_as<Layout, std::layout_right>};
+        const std::size_t major{result.major_extent()};
+        const std::size_t minor{by_rows ? result.columns : result.rows};
+        result.offsets.reserve(major + 1);
+        for (std::size_t i = 0; i < major; ++i) {
+            for (std::size_t j = 0; j < minor; ++j) {
+                const auto value{by_rows ? m[i, j] : m[j, i]};
+                if (value != T{}) {
+                    result.indices.push_back(static_cast<index_t>(j));
+                    result.values.push_back(value);
+                }
+            }
+            result.offsets.push_back(result.values.size());
+        }
+        return result;
+    }
+
+
+    /*
+        description:
+            converts a compressed matrix to CSR (std::layout_right) or CSC
+       (std::layout_left) with a counting sort, indices stay sorted
+    */
+    template <typename Layout, typename T, typename LP>
+    auto to_layout(const compressed_matrix<T, LP>& m)
+        -> compressed_matrix<T, Layout> {
+        if constexpr (std::same_as<Layout, LP>) {
+            return m;
+        } else {
+            check_extents(m.rows, m.columns);
+            compressed_matrix<T, Layout> result{.rows = m.rows,
+                                                .columns = m.columns};
+            const std::size_t major{result.major_extent()};
+            result.offsets.assign(major + 1, 0);
+            for (const index_t index : m.indices) {
+                ++result.offsets[index + 1];
+            }
+            std::partial_sum(result.offsets.begin(),
+                             result.offsets.end(),
+                             result.offsets.begin());
+            result.indices.resize(m.non_zeros());
+            result.values.resize(m.non_zeros());
+            std::vector<std::size_t> next(result.offsets.begin(),
+                                          result.offsets.end() - 1);
+            for (std::size_t i = 0; i < m.major_extent(); ++i) {
+                for (std::size_t k = m.offsets[i]; k < m.offsets[i + 1]; ++k) {
+                    const std::size_t position{next[m.indices[k]]++};
+                    result.indices[position] = static_cast<index_t>(i);
+                    result.values[position] = m.values[k];
+                }
+            }
+            return result;
+        }
+    }
+
+
+    /*
+        description:
+            dense copy of m in the layout of m
+    */
+    template <typename T, typename LP>
+    auto to_dense(const compressed_matrix<T, LP>& m)
+        -> std::pair<std::vector<T>, ::ranges::matrix_view<T, LP>> {
+        std::vector<T> values(m.rows * m.columns, T{});
+        const std::size_t minor{
+            std::same_as<LP, std::layout_right> ? m.columns : m.rows};
+        for (std::size_t i = 0; i < m.major_extent(); ++i) {
+            for (std::size_t k = m.offsets[i]; k < m.offsets[i + 1]; ++k) {
+                values[i * minor + m.indices[k]] = m.values[k];
+            }
+        }
+        ::ranges::matrix_view<T, LP> view{values, m.rows, m.columns, LP{}};
+        return std::pair{std::move(values), view};
+    }
+
+
+    /*
+        description:
+            sparse matrix - vector product (SpMV). CSR rows are split between
+       threads, for CSC every thread accumulates its columns into a private
+       vector and the vectors are summed at the end
+    */
+    template <typename T, typename LP>
+    auto multiply(const compressed_matrix<T, LP>& m, std::span<const T> x)
+        -> std::vector<T> {
+        assert(x.size() == m.columns);
+        std::vector<T> y(m.rows, T{});
+        if constexpr (std::same_as<LP, std::layout_right>) {
+            for_each_chunk(m.rows, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    T sum{};
+                    for (std::size_t k = m.offsets[i]; k < m.offsets[i + 1];
+                         ++k) {
+                        sum += m.values[k] * x[m.indices[k]];
+                    }
+                    y[i] = sum;
+                }
+            });
+        } else {
+            std::vector<std::vector<T>> partial_sums;
+            std::mutex partial_sums_mutex;
+            for_each_chunk(m.columns, [&](std::size_t begin, std::size_t end) {
+                std::vector<T> partial(m.rows, T{});
+                for (std::size_t j = begin; j < end; ++j) {
+                    for (std::size_t k = m.offsets[j]; k < m.offsets[j + 1];
+                         ++k) {
+                        partial[m.indices[k]] += m.values[k] * x[j];
+                    }
+                }
+                const std::scoped_lock lock{partial_sums_mutex};
+                partial_sums.push_back(std::move(partial));
+            });
+            for (const auto& partial : partial_sums) {
+                for (std::size_t i = 0; i < m.rows; ++i) { y[i] += partial[i]; }
+            }
+        }
+        return y;
+    }
+
+
+    /*
+        description:
+            sparse matrix - dense matrix product (SpMM), the result is a
+       row-major dense matrix. Rows of the result are split between threads,
+       row i is the combination of rows of dense selected by row i of m
+    */
+    template <typename T, typename LP, typename LP2>
+    auto multiply(const compressed_matrix<T, LP>& m,
+                  ::ranges::matrix_view<T, LP2> dense)
+        -> std::pair<std::vector<T>,
+                     ::ranges::matrix_view<T, std::layout_right>> {
+        assert(dense.number_of_rows() == m.columns);
+        if constexpr (!std::same_as<LP, std::layout_right>) {
+            return multiply(to_layout<std::layout_right>(m), dense);
+        } else {
+            const std::size_t columns{dense.number_of_columns()};
+            std::vector<T> values(m.rows * columns, T{});
+            for_each_chunk(m.rows, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    T* row{values.data() + i * columns};
+                    for (std::size_t k = m.offsets[i]; k < m.offsets[i + 1];
+                         ++k) {
+                        const T factor{m.values[k]};
+                        const std::size_t dense_row{m.indices[k]};
+                        for (std::size_t j = 0; j < columns; ++j) {
+                            row[j] += factor * dense[dense_row, j];
+                        }
+                    }
+                }
+            });
+            ::ranges::matrix_view result{
+                values.data(), m.rows, columns, layout::row};
+            return std::pair{std::move(values), result};
+        }
+    }
+
+
+    /*
+        description:
+            minimum degree ordering of the symmetric pattern of m + m^T. The
+       vertex of the smallest degree in the elimination graph is eliminated
+       first and its neighbours become a clique, which greedily keeps the fill
+       created by the elimination small. Returns the order in which columns
+       should be eliminated
+    */
+    template <typename T, typename LP>
+    auto minimum_degree_ordering(const compressed_matrix<T, LP>& m)
+        -> std::vector<index_t> {
+        const std::size_t n{m.major_extent()};
+        std::vector<std::vector<index_t>> adjacency(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t k = m.offsets[i]; k < m.offsets[i + 1]; ++k) {
+                const index_t j{m.indices[k]};
+                if (j != i) {
+                    adjacency[i].push_back(j);
+                    adjacency[j].push_back(static_cast<index_t>(i));
+                }
+            }
+        }
+        using degree_and_vertex = std::pair<std::size_t, index_t>;
+        std::priority_queue<degree_and_vertex,
+                            std::vector<degree_and_vertex>,
+                            std::greater<>>
+            smallest_degree;
+        for (std::size_t i = 0; i < n; ++i) {
+            std::ranges::sort(adjacency[i]);
+            const auto [first, last] = std::ranges::unique(adjacency[i]);
+            adjacency[i].erase(first, last);
+            smallest_degree.emplace(adjacency[i].size(),
+                                    static_cast<index_t>(i));
+        }
+
+        std::vector<index_t> order;
+        order.reserve(n);
+        std::vector<bool> eliminated(n, false);
+        std::vector<index_t> merged;
+        while (order.size() < n) {
+            const auto [degree, v] = smallest_degree.top();
+            smallest_degree.pop();
+            if (eliminated[v] || degree != adjacency[v].size()) { continue; }
+            eliminated[v] = true;
+            order.push_back(v);
+            const auto neighbours{std::move(adjacency[v])};
+            for (const index_t u : neighbours) {
+                merged.clear();
+                std::ranges::set_union(
+                    adjacency[u], neighbours, std::back_inserter(merged));
+                std::erase_if(merged, [&](index_t w) {
+                    return w == u || eliminated[w];
+                });
+                std::swap(adjacency[u], merged);
+                smallest_degree.emplace(adjacency[u].size(), u);
+            }
+        }
+        return order;
+    }
+
+
+    /*
+        description:
+            solves m * x = b by sparse Gaussian elimination. Columns are
+       eliminated in minimum degree order, rows are kept as sorted lists of
+       non-zero entries, so only non-zeros are touched. The pivot of each
+       column is the shortest row whose entry is at least pivot_threshold
+       times the largest candidate (threshold partial pivoting), which trades
+       a little stability for less fill
+    */
+    template <std::floating_point F, typename LP>
+    auto solve(const compressed_matrix<F, LP>& m,
+               std::ranges::range auto b,
+               F pivot_threshold = static_cast<F>(0.1))
+        -> std::expected<std::vector<F>, error> {
+        if (m.rows != m.columns) { return std::unexpected(error::not_square); }
+        const std::size_t n{m.rows};
+        const auto by_rows{to_layout<std::layout_right>(m)};
+        const auto order{minimum_degree_ordering(by_rows)};
+        std::vector<index_t> position(n);
+        for (std::size_t k = 0; k < n; ++k) {
+            position[order[k]] = static_cast<index_t>(k);
+        }
+
+        // entries are (position of column, value), sorted by position
+        using entry = std::pair<index_t, F>;
+        std::vector<std::vector<entry>> rows(n);
+        std::vector<std::vector<index_t>> rows_in_column(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t k = by_rows.offsets[i]; k < by_rows.offsets[i + 1];
+                 ++k) {
+                rows[i].emplace_back(position[by_rows.indices[k]],
+                                     by_rows.values[k]);
+                rows_in_column[position[by_rows.indices[k]]].push_back(
+                    static_cast<index_t>(i));
+            }
+            std::ranges::sort(rows[i], {}, &entry::first);
+        }
+        std::vector<F> rhs{};
+        rhs.reserve(n);
+        for (auto&& value : b) { rhs.push_back(static_cast<F>(value)); }
+        assert(rhs.size() == n);
+
+        std::vector<index_t> pivot_rows(n);
+        std::vector<bool> done(n, false);
+        std::vector<std::size_t> candidate_of(n, n);
+        std::vector<index_t> candidates;
+        std::vector<entry> merged;
+        for (std::size_t k = 0; k < n; ++k) {
+            candidates.clear();
+            F largest{0};
+            for (const index_t r : rows_in_column[k]) {
+                if (done[r] || candidate_of[r] == k || rows[r].empty() ||
+                    rows[r].front().first != k) {
+                    continue;
+                }
+                candidate_of[r] = k;
+                candidates.push_back(r);
+                largest = std::max(largest, std::abs(rows[r].front().second));
+            }
+            if (largest == F{0}) {
+                return std::unexpected(error::not_invertible);
+            }
+            index_t pivot{candidates.front()};
+            std::size_t pivot_length{n + 1};
+            for (const index_t r : candidates) {
+                if (std::abs(rows[r].front().second) >=
+                        pivot_threshold * largest &&
+                    rows[r].size() < pivot_length) {
+                    pivot = r;
+                    pivot_length = rows[r].size();
+                }
+            }
+            done[pivot] = true;
+            pivot_rows[k] = pivot;
+
+            const auto& pivot_row{rows[pivot]};
+            for (const index_t r : candidates) {
+                if (r == pivot) { continue; }
+                const F factor{rows[r].front().second /
+                               pivot_row.front().second};
+                rhs[r] -= factor * rhs[pivot];
+                merged.clear();
+                auto a{rows[r].begin() + 1};
+                auto p{pivot_row.begin() + 1};
+                while (a != rows[r].end() || p != pivot_row.end()) {
+                    if (p == pivot_row.end() ||
+                        (a != rows[r].end() && a->first < p->first)) {
+                        merged.push_back(*a++);
+                    } else if (a == rows[r].end() || p->first < a->first) {
+                        merged.emplace_back(p->first, -factor * p->second);
+                        rows_in_column[p->first].push_back(r);
+                        ++p;
+                    } else {
+                        const F value{a->second - factor * p->second};
+                        if (value != F{0}) { merged.emplace_back(a->first, value); }
+                        ++a;
+                        ++p;
+                    }
+                }
+                std::swap(rows[r], merged);
+            }
+            std::vector<index_t>{}.swap(rows_in_column[k]);
+        }
+
+        std::vector<F> solution_by_position(n);
+        for (std::size_t k = n; k-- > 0;) {
+            const auto& row{rows[pivot_rows[k]]};
+            F sum{rhs[pivot_rows[k]]};
+            for (auto it = row.begin() + 1; it != row.end(); ++it) {
+                sum -= it->second * solution_by_position[it->first];
+            }
+            solution_by_position[k] = sum / row.front().second;
+        }
+        std::vector<F> x(n);
+        for (std::size_t k = 0; k < n; ++k) {
+            x[order[k]] = solution_by_position[k];
+        }
+        return x;
+    }
+
+}  // namespace algebra::sparse
+
+
+namespace tests_of_sparse_matrix {
+
+    inline bool test_of_conversions() {
+        std::vector v{1.0, 0.0, 2.0, 0.0, 0.0, 3.0, 4.0, 0.0, 5.0};
+        ::ranges::matrix_view m(v, 3, 3, layout::row);
+        auto csr = algebra::sparse::to_compressed<std::layout_right>(m);
+        assert(csr.non_zeros() == 5);
+        assert((csr.offsets == std::vector<std::size_t>{0, 2, 3, 5}));
+        assert((csr.indices == std::vector<algebra::sparse::index_t>{
+                                   0, 2, 2, 0, 2}));
+
+        auto csc = algebra::sparse::to_layout<std::layout_left>(csr);
+        assert((csc.offsets == std::vector<std::size_t>{0, 2, 2, 5}));
+        assert((csc.values == std::vector{1.0, 4.0, 2.0, 3.0, 5.0}));
+        auto [dense_vector, dense] = algebra::sparse::to_dense(csc);
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                assert((dense[i, j] == m[i, j]));
+            }
+        }
+
+        // rows beyond index_t would become truncated CSC indices
+        using algebra::sparse::index_t;
+        const algebra::sparse::csr_matrix<double> tall{
+            .rows = std::size_t{std::numeric_limits<index_t>::max()} + 1,
+            .columns = 1};
+        bool rejected{false};
+        try {
+            algebra::sparse::to_layout<std::layout_left>(tall);
+        } catch (const std::length_error&) {
+            rejected = true;
+        }
+        assert(rejected);
+        return true;
+    }
+
+
+    inline bool test_of_products() {
+        std::vector v{1.0, 0.0, 2.0, 0.0, 0.0, 3.0, 4.0, 0.0, 5.0};
+        ::ranges::matrix_view m(v, 3, 3, layout::row);
+        auto csr = algebra::sparse::to_compressed<std::layout_right>(m);
+        auto csc = algebra::sparse::to_compressed<std::layout_left>(m);
+        const std::vector x{1.0, 2.0, 3.0};
+        assert((algebra::sparse::multiply(csr, std::span{x}) ==
+                std::vector{7.0, 9.0, 19.0}));
+        assert((algebra::sparse::multiply(csc, std::span{x}) ==
+                std::vector{7.0, 9.0, 19.0}));
+
+        std::vector b{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+        ::ranges::matrix_view dense(b, 3, 2, layout::row);
+        auto [product_vector, product] = algebra::sparse::multiply(csc, dense);
+        assert((product_vector == std::vector{11.0, 14.0, 15.0, 18.0, 29.0,
+                                              38.0}));
+        return true;
+    }
+
+
+    inline bool test_of_solve() {
+        // zero on the diagonal forces pivoting
+        std::vector v{0.0, 2.0, 1.0, 1.0, 1.0, 1.0, 2.0, 1.0, 3.0};
+        ::ranges::matrix_view m(v, 3, 3, layout::row);
+        auto csr = algebra::sparse::to_compressed<std::layout_right>(m);
+        auto x = algebra::sparse::solve(csr, std::vector{3.0, 3.0, 6.0});
+        assert(x.has_value());
+        for (const double value : *x) { assert(std::abs(value - 1.0) < 1e-12); }
+
+        std::vector singular{1.0, 2.0, 2.0, 4.0};
+        ::ranges::matrix_view s(singular, 2, 2, layout::row);
+        assert(!algebra::sparse::solve(
+                    algebra::sparse::to_compressed<std::layout_left>(s),
+                    std::vector{1.0, 1.0})
+                    .has_value());
+        return true;
+    }
+
+
+    inline void all_test() {
+        assert(test_of_conversions());
+        assert(test_of_products());
+        assert(test_of_solve());
+        std::println("\n\nAll Sparse Matrix Tests Passed Succesfully!");
+    }
+}  // namespace tests_of_sparse_matrix
@@ -1,6 +1,83 @@
 
 namespace ranges {
 
+    template <std::ranges::viewable_range R>
+    class numeric_view;
+
+
+    template <typename T>
+    struct is_numeric_view : std::false_type {};
+
+
+    template <typename R>
+    struct is_numeric_view<numeric_view<R>> : std::true_type {};
+
+
+    /*lazy coordinate-wise expressions over rows (numeric_views), e.g.
+     * factor * row_i or row_i - row_j. Nothing is computed until the
+     * expression is applied with += or -= to a numeric_view, which then runs
+     * a single loop over the row without temporaries*/
+    template <typename E>
+    struct is_row_expression : std::false_type {};
+
+
+    template <typename E>
+    concept row_expression = is_row_expression<std::remove_cvref_t<E>>::value;
+
+
+    template <typename E>
+    concept row_operand =
+        row_expression<E> || is_numeric_view<std::remove_cvref_t<E>>::value;
+
+
+    template <typename S>
+    concept row_scalar = !row_operand<S> && !std::ranges::range<S>;
+
+
+    /*scalar * operand, evaluated coordinate by coordinate*/
+    template <row_scalar S, row_operand E>
+    struct scaled_expression {
+        S scalar;
+        E operand;
+
+
+        constexpr auto operator[](std::size_t i) const {
+            return scalar * operand[i];
+        }
+
+
+        constexpr auto size() const -> std::size_t {
+            return static_cast<std::size_t>(std::ranges::size(operand));
+        }
+    };
+
+
+    /*left op right, evaluated coordinate by coordinate*/
+    template <row_operand L, row_operand R, typename Op>
+    struct binary_expression {
+        L left;
+        R right;
+
+
+        constexpr auto operator[](std::size_t i) const {
+            return Op{}(left[i], right[i]);
+        }
+
+
+        constexpr auto size() const -> std::size_t {
+            return static_cast<std::size_t>(std::ranges::size(left));
+        }
+    };
+
+
+    template <typename S, typename E>
+    struct is_row_expression<scaled_expression<S, E>> : std::true_type {};
+
+
+    template <typename L, typename R, typename Op>
+    struct is_row_expression<binary_expression<L, R, Op>> : std::true_type {};
+
+
     /*this class will be used to modify rows columns of a matrix. It vectorizes
      * operations on ranges*/
     template <std::ranges::viewable_range R>
@@ -89,6 +166,57 @@ namespace ranges {
             });
             return *this;
         }
+
+        // Fused coordinate-wise addition of a lazy expression
+        template <row_expression E>
+        constexpr auto operator+=(const E& e) -> auto& {
+            apply(e, [](auto& a, auto b) { a += b; });
+            return *this;
+        }
+
+        // Fused coordinate-wise subtraction of a lazy expression, e.g.
+        // row_k -= factor * row_i
+        template <row_expression E>
+        constexpr auto operator-=(const E& e) -> auto& {
+            apply(e, [](auto& a, auto b) { a -= b; });
+            return *this;
+        }
+
+      private:
+        // single indexed loop, so that it can be vectorized for arithmetic
+        // types
+        template <row_expression E, typename Op>
+        constexpr auto apply(const E& e, Op op) -> void {
+            auto first{this->begin()};
+            const auto n{std::ranges::distance(*this)};
+            for (std::ranges::range_difference_t<R> i = 0; i < n; ++i) {
+                op(first[i], e[static_cast<std::size_t>(i)]);
+            }
+        }
     };
 
+
+    template <row_scalar S, row_operand E>
+    constexpr auto operator*(S scalar, E operand) {
+        return scaled_expression<S, E>{scalar, operand};
+    }
+
+
+    template <row_operand E, row_scalar S>
+    constexpr auto operator*(E operand, S scalar) {
+        return scaled_expression<S, E>{scalar, operand};
+    }
+
+
+    template <row_operand L, row_operand R>
+    constexpr auto operator+(L left, R right) {
+        return binary_expression<L, R, std::plus<>>{left, right};
+    }
+
+
+    template <row_operand L, row_operand R>
+    constexpr auto operator-(L left, R right) {
+        return binary_expression<L, R, std::minus<>>{left, right};
+    }
+
 }  // namespace ranges
@@ -0,0 +1,363 @@
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
+#include <print>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "basic_algebra_2_pack.hpp"
+#include "lu_decomposition.hpp"
+#include "timer.hpp"
+
+#if defined(ALGEBRA2_WITH_EIGEN)
+#include <Eigen/Dense>
+#endif
+
+
+namespace {
+
+    constexpr std::size_t default_repetitions{10};
+    constexpr std::size_t sizes[]{64, 128, 256, 512};
+    constexpr std::size_t fraction_sizes[]{3, 4, 5};
+
+
+    struct measurement {
+        std::string_view library{};
+        std::string_view operation{};
+        std::string_view layout{};
+        std::size_t n{};
+        benchmarking::statistics times{};
+    };
+
+
+    enum class output_format { csv, json };
+
+
+    auto random_values(std::size_t n, std::mt19937& generator)
+        -> std::vector<double> {
+        std::uniform_real_distribution<double> entries{-1.0, 1.0};
+        std::vector<double> values(n * n);
+        for (auto& value : values) { value = entries(generator); }
+        // a dominant diagonal keeps every matrix of the benchmark invertible
+        for (std::size_t i = 0; i < n; ++i) {
+            values[i * n + i] += static_cast<double>(n);
+        }
+        return values;
+    }
+
+
+    /*
+        description:
+            integer matrix S L S T U T, where L and U are the unit triangular
+       matrices of ones and S, T random diagonal matrices of signs. Every pivot
+       of the elimination is 1 and the inverses of both factors are
+       bidiagonal, so the fraction<int> entries stay below a few n even for
+       n = 512 while every multiplier is non-zero
+    */
+    auto exact_values(std::size_t n, std::mt19937& generator)
+        -> std::vector<int> {
+        std::bernoulli_distribution positive{};
+        std::vector<int> s(n);
+        std::vector<int> t(n);
+        for (auto& sign : s) { sign = positive(generator) ? 1 : -1; }
+        for (auto& sign : t) { sign = positive(generator) ? 1 : -1; }
+        std::vector<int> values(n * n);
+        for (std::size_t i = 0; i < n; ++i) {
+            int prefix{0};
+            for (std::size_t j = 0; j < n; ++j) {
+                // (S L S T U T)[i, j] = s_i t_j sum_{k <= min(i, j)} s_k t_k
+                if (j <= i) { prefix += s[j] * t[j]; }
+                values[i * n + j] = s[i] * t[j] * prefix;
+            }
+        }
+        return values;
+    }
+
+
+    template <typename LP>
+    constexpr auto layout_name() -> std::string_view {
+        return std::is_same_v<LP, std::layout_right> ? "row" : "column";
+    }
+
+
+    /*
+        description:
+            measures every operation of the library on n x n matrices stored
+       in layout LP
+    */
+    template <typename LP>
+    auto benchmark_algebra2(std::size_t n,
+                            std::size_t repetitions,
+                            std::mt19937& generator,
+                            const std::filesystem::path& directory,
+                            std::vector<measurement>& results) -> void {
+        auto a_values{random_values(n, generator)};
+        auto b_values{random_values(n, generator)};
+        ::ranges::matrix_view<double, LP> a{a_values.data(), n, n, LP{}};
+        ::ranges::matrix_view<double, LP> b{b_values.data(), n, n, LP{}};
+        const std::vector<double> y(n, 1.0);
+        // the exact elimination of the library works on fraction<int>, so it
+        // gets an integer matrix whose elimination cannot overflow
+        auto exact_entries{exact_values(n, generator)};
+        ::ranges::matrix_view<int, LP> exact{
+            exact_entries.data(), n, n, LP{}};
+        std::vector<int> ones(n, 1);
+        const auto csv{directory / "matrix.csv"};
+        const auto bin{directory / "matrix.bin"};
+
+        auto measure = [&](std::string_view operation, auto&& func) {
+            results.push_back({"algebra2",
+                               operation,
+                               layout_name<LP>(),
+                               n,
+                               benchmarking::sample(repetitions, func)});
+        };
+        measure("multiply", [&] {
+            benchmarking::do_not_optimize(algebra::matrix_multiply(a, b));
+        });
+        measure("transpose", [&] {
+            benchmarking::do_not_optimize(::ranges::transpose_copy(a));
+        });
+        measure("determinant", [&] {
+            benchmarking::do_not_optimize(
+                algorithms::gaussian_elimination::determinant(exact));
+        });
+        measure("inverse", [&] {
+            benchmarking::do_not_optimize(
+                algorithms::gaussian_elimination::inverse(exact));
+        });
+        measure("solve", [&] {
+            benchmarking::do_not_optimize(algebra::solve(exact, ones));
+        });
+        measure("determinant (LU)", [&] {
+            auto lu{algorithms::lu_decomposition::factorize(a)};
+            benchmarking::do_not_optimize(lu->determinant());
+        });
+        measure("inverse (LU)", [&] {
+            auto lu{algorithms::lu_decomposition::factorize(a)};
+            benchmarking::do_not_optimize(lu->inverse());
+        });
+        measure("solve (LU)", [&] {
+            auto lu{algorithms::lu_decomposition::factorize(a)};
+            benchmarking::do_not_optimize(lu->solve(y));
+        });
+        measure("save text", [&] { matrix::save<',', ';'>(a, csv); });
+        measure("load text", [&] {
+            benchmarking::do_not_optimize(matrix::load<double, ',', ';'>(csv));
+        });
+        measure("save binary", [&] {
+            benchmarking::do_not_optimize(matrix::save_binary(a, bin));
+        });
+        measure("load binary", [&] {
+            benchmarking::do_not_optimize(matrix::load_binary<double, LP>(bin));
+        });
+    }
+
+
+    /*
+        description:
+            exact elimination over fractions, only tiny sizes keep the
+       numerators and denominators of fraction<int> from overflowing
+    */
+    auto benchmark_fractions(std::size_t n,
+                             std::size_t repetitions,
+                             std::mt19937& generator,
+                             std::vector<measurement>& results) -> void {
+        std::uniform_int_distribution<int> entries{-3, 3};
+        std::vector<int> values(n * n);
+        for (auto& value : values) { value = entries(generator); }
+        ::ranges::matrix_view m(values, n, n, layout::row);
+        results.push_back(
+            {"algebra2",
+             "determinant (fractions)",
+             "row",
+             n,
+             benchmarking::sample(repetitions, [&] {
+                 benchmarking::do_not_optimize(
+                     algorithms::gaussian_elimination::determinant(m));
+             })});
+    }
+
+
+#if defined(ALGEBRA2_WITH_EIGEN)
+    /*
+        description:
+            the same operations done by Eigen with partial pivoting LU, which
+       is the algorithm used by lu_decomposition as well
+    */
+    template <typename LP>
+    auto benchmark_eigen(std::size_t n,
+                         std::size_t repetitions,
+                         std::mt19937& generator,
+                         std::vector<measurement>& results) -> void {
+        constexpr int storage{std::is_same_v<LP, std::layout_right>
+                                  ? Eigen::RowMajor
+                                  : Eigen::ColMajor};
+        using eigen_matrix =
+            Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, storage>;
+        const auto a_values{random_values(n, generator)};
+        const auto b_values{random_values(n, generator)};
+        const auto size{static_cast<Eigen::Index>(n)};
+        const eigen_matrix a{
+            Eigen::Map<const eigen_matrix>(a_values.data(), size, size)};
+        const eigen_matrix b{
+            Eigen::Map<const eigen_matrix>(b_values.data(), size, size)};
+        const Eigen::VectorXd y{Eigen::VectorXd::Ones(size)};
+
+        auto measure = [&](std::string_view operation, auto&& func) {
+            results.push_back({"eigen",
+                               operation,
+                               layout_name<LP>(),
+                               n,
+                               benchmarking::sample(repetitions, func)});
+        };
+        measure("multiply", [&] {
+            eigen_matrix product{a * b};
+            benchmarking::do_not_optimize(product.data());
+        });
+        measure("transpose", [&] {
+            eigen_matrix transposed{a.transpose()};
+            benchmarking::do_not_optimize(transposed.data());
+        });
+        measure("determinant (LU)", [&] {
+            benchmarking::do_not_optimize(a.partialPivLu().determinant());
+        });
+        measure("inverse (LU)", [&] {
+            eigen_matrix inverse{a.partialPivLu().inverse()};
+            benchmarking::do_not_optimize(inverse.data());
+        });
+        measure("solve (LU)", [&] {
+            Eigen::VectorXd x{a.partialPivLu().solve(y)};
+            benchmarking::do_not_optimize(x.data());
+        });
+    }
+#endif
+
+
+    /*
+        description:
+            median time of the Eigen measurement of the same operation, layout
+       and size, NaN when Eigen has no counterpart or was not built in
+    */
+    auto baseline_of(const measurement& m,
+                     const std::vector<measurement>& results) -> double {
+        for (const auto& other : results) {
+            if (other.library == "eigen" && other.operation == m.operation &&
+                other.layout == m.layout && other.n == m.n) {
+                return other.times.median;
+            }
+        }
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+
+    auto print_csv(const std::vector<measurement>& results) -> void {
+        std::println("library,operation,layout,n,repetitions,min_ms,median_ms,"
+                     "mean_ms,stddev_ms,median_vs_eigen");
+        for (const auto& m : results) {
+            const double baseline{baseline_of(m, results)};
+            std::print("{},{},{},{},{},{:.6f},{:.6f},{:.6f},{:.6f},",
+                       m.library,
+                       m.operation,
+                       m.layout,
+                       m.n,
+                       m.times.repetitions,
+                       m.times.minimum,
+                       m.times.median,
+                       m.times.mean,
+                       m.times.standard_deviation);
+            if (std::isnan(baseline)) {
+                std::println("");
+            } else {
+                std::println("{:.3f}", m.times.median / baseline);
+            }
+        }
+    }
+
+
+    auto print_json(const std::vector<measurement>& results) -> void {
+        std::println("[");
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const auto& m{results[i]};
+            const double baseline{baseline_of(m, results)};
+            std::print("  {{\"library\": \"{}\", \"operation\": \"{}\", "
+                       "\"layout\": \"{}\", \"n\": {}, \"repetitions\": {}, "
+                       "\"min_ms\": {:.6f}, \"median_ms\": {:.6f}, "
+                       "\"mean_ms\": {:.6f}, \"stddev_ms\": {:.6f}, "
+                       "\"median_vs_eigen\": ",
+                       m.library,
+                       m.operation,
+                       m.layout,
+                       m.n,
+                       m.times.repetitions,
+                       m.times.minimum,
+                       m.times.median,
+                       m.times.mean,
+                       m.times.standard_deviation);
+            if (std::isnan(baseline)) {
+                std::print("null");
+            } else {
+                std::print("{:.3f}", m.times.median / baseline);
+            }
+            std::println("}}{}", i + 1 < results.size() ? "," : "");
+        }
+        std::println("]");
+    }
+
+}  // namespace
+
+
+/*
+    usage: algebra2_benchmark [--json] [repetitions]
+    prints one record per library, operation, layout and size, median_vs_eigen
+   is the ratio of medians (below 1 means faster than Eigen). Only multiply,
+   transpose and the "(LU)" rows have an Eigen counterpart, the exact
+   fraction<int> determinant, inverse and solve and the file rows have none
+*/
+int main(int argc, char** argv) {
+    output_format format{output_format::csv};
+    std::size_t repetitions{default_repetitions};
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view argument{argv[i]};
+        if (argument == "--json") {
+            format = output_format::json;
+        } else {
+            std::from_chars(argument.data(),
+                            argument.data() + argument.size(),
+                            repetitions);
+        }
+    }
+
+#if !defined(ALGEBRA2_WITH_EIGEN)
+    std::println(stderr, "built without Eigen, median_vs_eigen stays empty");
+#endif
+
+    std::mt19937 generator{42};
+    const auto directory{std::filesystem::temp_directory_path() /
+                         "algebra2_benchmark"};
+    std::vector<measurement> results{};
+    for (const std::size_t n : sizes) {
+        benchmark_algebra2<std::layout_right>(
+            n, repetitions, generator, directory, results);
+        benchmark_algebra2<std::layout_left>(
+            n, repetitions, generator, directory, results);
+#if defined(ALGEBRA2_WITH_EIGEN)
+        benchmark_eigen<std::layout_right>(n, repetitions, generator, results);
+        benchmark_eigen<std::layout_left>(n, repetitions, generator, results);
+#endif
+    }
+    for (const std::size_t n : fraction_sizes) {
+        benchmark_fractions(n, repetitions, generator, results);
+    }
+    std::filesystem::remove_all(directory);
+
+    if (format == output_format::json) {
+        print_json(results);
+    } else {
+        print_csv(results);
+    }
+    return 0;
+}
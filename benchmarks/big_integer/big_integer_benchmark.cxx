@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <print>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Number_theory.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+    /*the quadratic factorial and printing are not run past these*/
+    constexpr std::uint64_t naive_factorial_limit{100'000};
+    constexpr std::size_t naive_digits_limit{100'000};
+
+    using number_theory::big_integer;
+    namespace detail = number_theory::big_integer_detail;
+
+
+    /*
+        description:
+            F(n) by n big additions, the way the eager recursion computes it
+    */
+    auto iterative_fibonacci(std::uint64_t n) -> big_integer {
+        big_integer previous{0};
+        big_integer current{1};
+        for (std::uint64_t i = 0; i < n; ++i) {
+            previous += current;
+            std::swap(previous, current);
+        }
+        return previous;
+    }
+
+
+    /*
+        description:
+            n! multiplied up one factor at a time
+    */
+    auto sequential_factorial(std::uint64_t n) -> big_integer {
+        big_integer result{1};
+        for (std::uint64_t i = 2; i <= n; ++i) { result *= i; }
+        return result;
+    }
+
+
+    /*
+        description:
+            decimal digits of value peeled off 19 at a time by dividing the
+       whole number by 10^19
+    */
+    auto naive_to_string(const big_integer& value) -> std::string {
+        detail::limbs magnitude(value.limbs().begin(), value.limbs().end());
+        std::string reversed;
+        while (!magnitude.empty()) {
+            std::uint64_t part{detail::divide_small(magnitude, 10'000'000'000'000'000'000ULL)};
+            for (int i = 0; i < 19; ++i) {
+                reversed.push_back(static_cast<char>('0' + part % 10));
+                part /= 10;
+            }
+        }
+        while (reversed.size() > 1 && reversed.back() == '0') { reversed.pop_back(); }
+        return {reversed.rbegin(), reversed.rend()};
+    }
+
+
+    auto cell(double milliseconds) -> std::string {
+        return milliseconds < 0 ? std::string{"-"} : std::format("{:.2f}", milliseconds);
+    }
+
+
+    /*
+        description:
+            milliseconds of a product of two random numbers of the given
+       number of limbs by Karatsuba's method and by the schoolbook method
+    */
+    auto benchmark_multiplication(std::size_t limbs, std::mt19937_64& generator) -> void {
+        detail::limbs a(limbs);
+        detail::limbs b(limbs);
+        std::ranges::generate(a, generator);
+        std::ranges::generate(b, generator);
+        detail::limbs out(2 * limbs);
+        const double karatsuba{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(detail::multiply(a, b));
+        })};
+        const double schoolbook{benchmarking::best_of(repetitions, [&] {
+            std::ranges::fill(out, 0);
+            detail::multiply_schoolbook(a, b, out);
+            benchmarking::do_not_optimize(out);
+        })};
+        std::println("{:>7} {:>12.2f} {:>12.2f}", limbs, karatsuba, schoolbook);
+    }
+
+
+    /*
+        description:
+            milliseconds of F(n) by fast doubling and by n additions, and of
+       n! by the product tree and one factor at a time
+    */
+    auto benchmark_sequences(std::uint64_t n) -> void {
+        const double doubling{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(number_theory::fibonacci(n));
+        })};
+        const double additions{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(iterative_fibonacci(n));
+        })};
+        const double tree{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(number_theory::factorial(n));
+        })};
+        double sequential{-1};
+        if (n <= naive_factorial_limit) {
+            sequential = benchmarking::best_of(repetitions, [&] {
+                benchmarking::do_not_optimize(sequential_factorial(n));
+            });
+        }
+        std::println("{:>9} {:>12.2f} {:>12.2f} {:>12.2f} {:>12}",
+                     n,
+                     doubling,
+                     additions,
+                     tree,
+                     cell(sequential));
+    }
+
+
+    /*
+        description:
+            milliseconds of parsing and printing a number of the given number
+       of decimal digits by divide and conquer, and of printing it by
+       repeated division by 10^19
+    */
+    auto benchmark_conversion(std::size_t digits, std::mt19937_64& generator) -> void {
+        std::uniform_int_distribution<int> digit{0, 9};
+        std::string text(digits, '0');
+        std::ranges::generate(text, [&] { return static_cast<char>('0' + digit(generator)); });
+        text.front() = '7';
+        big_integer value;
+        const double parse{benchmarking::best_of(repetitions, [&] {
+            value = big_integer{text};
+            benchmarking::do_not_optimize(value);
+        })};
+        const double print{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(value.to_string());
+        })};
+        double naive{-1};
+        if (digits <= naive_digits_limit) {
+            naive = benchmarking::best_of(repetitions, [&] {
+                benchmarking::do_not_optimize(naive_to_string(value));
+            });
+        }
+        std::println("{:>9} {:>12.2f} {:>12.2f} {:>12}", digits, parse, print, cell(naive));
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937_64 generator{42};
+    std::println("milliseconds (best of {})\n", repetitions);
+    std::println("multiplication of two random numbers");
+    std::println("{:>7} {:>12} {:>12}", "limbs", "karatsuba", "schoolbook");
+    for (std::size_t limbs = 16; limbs <= 16'384; limbs *= 4) {
+        benchmark_multiplication(limbs, generator);
+    }
+    std::println("\nfibonacci and factorial");
+    std::println("{:>9} {:>12} {:>12} {:>12} {:>12}", "n", "doubling", "additions", "tree", "sequential");
+    for (std::uint64_t n = 1'000; n <= 1'000'000; n *= 10) { benchmark_sequences(n); }
+    std::println("\ndecimal conversion");
+    std::println("{:>9} {:>12} {:>12} {:>12}", "digits", "parse", "print", "naive print");
+    for (std::size_t digits = 1'000; digits <= 1'000'000; digits *= 10) {
+        benchmark_conversion(digits, generator);
+    }
+    return 0;
+}
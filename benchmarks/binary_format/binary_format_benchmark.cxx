@@ -0,0 +1,86 @@
+#include <charconv>
+#include <filesystem>
+#include <print>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "matrix.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+    constexpr std::size_t default_size{10'000};
+
+
+    template <typename T, typename LP>
+    auto sum(ranges::matrix_view<T, LP> m) -> double {
+        double total{0.0};
+        for (std::size_t i = 0; i < m.number_of_rows(); ++i) {
+            for (std::size_t j = 0; j < m.number_of_columns(); ++j) {
+                total += m[i, j];
+            }
+        }
+        return total;
+    }
+
+}  // namespace
+
+
+/*
+    usage: binary_format_benchmark [n], the default n x n double matrix is
+   10000 x 10000 (800 MB binary, a few GB as text)
+*/
+int main(int argc, char** argv) {
+    std::size_t n{default_size};
+    if (argc > 1) {
+        const std::string_view argument{argv[1]};
+        std::from_chars(argument.data(), argument.data() + argument.size(), n);
+    }
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> entries{-1.0, 1.0};
+    std::vector<double> values(n * n);
+    for (auto& value : values) { value = entries(generator); }
+    ::ranges::matrix_view m(values, n, n, layout::row);
+
+    const auto directory{std::filesystem::temp_directory_path() /
+                         "binary_format_benchmark"};
+    const auto csv{directory / "matrix.csv"};
+    const auto bin{directory / "matrix.bin"};
+
+    const double save_csv{benchmarking::best_of(
+        1, [&] { matrix::save<',', ';'>(m, csv); })};
+    const double save_bin{benchmarking::best_of(
+        repetitions, [&] { matrix::save_binary(m, bin); })};
+    const double load_csv{benchmarking::best_of(1, [&] {
+        benchmarking::do_not_optimize(matrix::load<double, ',', ';'>(csv));
+    })};
+    const double load_bin{benchmarking::best_of(repetitions, [&] {
+        benchmarking::do_not_optimize(matrix::load_binary<double>(bin));
+    })};
+    const double map_bin{benchmarking::best_of(repetitions, [&] {
+        benchmarking::do_not_optimize(matrix::map_binary<double>(bin));
+    })};
+    const double map_and_read_bin{benchmarking::best_of(repetitions, [&] {
+        auto mapped{matrix::map_binary<double>(bin)};
+        benchmarking::do_not_optimize(sum(mapped->view()));
+    })};
+
+    std::println("{} x {} doubles, csv {:.1f} MB, binary {:.1f} MB",
+                 n,
+                 n,
+                 static_cast<double>(std::filesystem::file_size(csv)) / 1e6,
+                 static_cast<double>(std::filesystem::file_size(bin)) / 1e6);
+    std::println("times in ms (text: single run, binary: best of {})",
+                 repetitions);
+    std::println("{:>24} {:>12.1f}", "save csv", save_csv);
+    std::println("{:>24} {:>12.1f}", "save binary", save_bin);
+    std::println("{:>24} {:>12.1f}", "load csv", load_csv);
+    std::println("{:>24} {:>12.1f}", "load binary (copy)", load_bin);
+    std::println("{:>24} {:>12.3f}", "map binary", map_bin);
+    std::println("{:>24} {:>12.1f}", "map binary + read all", map_and_read_bin);
+    std::filesystem::remove_all(directory);
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <format>
+#include <print>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Number_theory.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+
+    // decompose divides by every number up to sqrt(value), so it only gets small batches
+    constexpr std::size_t decompose_count{1'000};
+
+
+    auto random_values(std::size_t count, int bits, std::mt19937_64& generator)
+        -> std::vector<std::uint64_t> {
+        std::vector<std::uint64_t> values(count);
+        for (auto& v : values) { v = generator() >> (64 - bits); }
+        return values;
+    }
+
+
+    /*
+        description:
+            numbers per second of decompose, of factorize one value at a
+       time and of factorize_batch for random values of the given bit length
+    */
+    auto benchmark_factorization(int bits,
+                                 std::size_t count,
+                                 std::mt19937_64& generator) -> void {
+        const auto values{random_values(count, bits, generator)};
+        const auto rate = [](std::size_t numbers, double milliseconds) {
+            return static_cast<double>(numbers) / milliseconds * 1000.0;
+        };
+        std::string decompose_rate{"-"};
+        if (bits <= 40) {
+            const double decompose{benchmarking::best_of(repetitions, [&] {
+                for (std::size_t i = 0; i < decompose_count; ++i) {
+                    benchmarking::do_not_optimize(
+                        number_theory::decompose(values[i]));
+                }
+            })};
+            decompose_rate =
+                std::format("{:.0f}", rate(decompose_count, decompose));
+        }
+        const double single{benchmarking::best_of(repetitions, [&] {
+            for (const auto v : values) {
+                benchmarking::do_not_optimize(number_theory::factorize(v));
+            }
+        })};
+        const double batch{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(
+                number_theory::factorize_batch(values));
+        })};
+        std::println("{:>5} {:>14} {:>14.0f} {:>14.0f}",
+                     bits,
+                     decompose_rate,
+                     rate(count, single),
+                     rate(count, batch));
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937_64 generator{42};
+    std::println("numbers per second (best of {})\n", repetitions);
+    std::println("{:>5} {:>14} {:>14} {:>14}",
+                 "bits",
+                 "decompose",
+                 "factorize",
+                 "batch");
+    for (int bits = 16; bits <= 64; bits += 8) {
+        benchmark_factorization(bits, 100'000, generator);
+    }
+    return 0;
+}
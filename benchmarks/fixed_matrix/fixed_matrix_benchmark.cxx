@@ -0,0 +1,122 @@
+#include <array>
+#include <print>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "basic_algebra_2_pack.hpp"
+#include "fixed_matrix.hpp"
+#include "lu_decomposition.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{5};
+    constexpr std::size_t batch{100'000};
+
+
+    /*
+        description:
+            batch of random N x N matrices with a dominant diagonal, so that
+       every one of them is invertible
+    */
+    template <std::size_t N>
+    auto random_batch(std::mt19937& generator)
+        -> std::vector<algebra::fixed::matrix<double, N, N>> {
+        std::uniform_real_distribution<double> entries{-1.0, 1.0};
+        std::vector<algebra::fixed::matrix<double, N, N>> matrices(batch);
+        for (auto& m : matrices) {
+            for (auto& value : m.values) { value = entries(generator); }
+            for (std::size_t i = 0; i < N; ++i) { m[i, i] += N; }
+        }
+        return matrices;
+    }
+
+
+    template <std::size_t N>
+    auto benchmark_size(std::mt19937& generator) -> void {
+        auto matrices{random_batch<N>(generator)};
+        std::array<double, N> y{};
+        y.fill(1.0);
+
+        auto compare = [&](std::string_view operation,
+                           auto&& fixed_size,
+                           auto&& dynamic) {
+            const double fixed_time{benchmarking::best_of(repetitions, [&] {
+                for (std::size_t i = 0; i + 1 < batch; ++i) {
+                    fixed_size(matrices[i], matrices[i + 1]);
+                }
+            })};
+            const double dynamic_time{benchmarking::best_of(repetitions, [&] {
+                for (std::size_t i = 0; i + 1 < batch; ++i) {
+                    dynamic(matrices[i].as_matrix_view(),
+                            matrices[i + 1].as_matrix_view());
+                }
+            })};
+            std::println("{:>3} {:>12} {:>12.3f} {:>12.3f} {:>8.1f}x",
+                         N,
+                         operation,
+                         fixed_time,
+                         dynamic_time,
+                         dynamic_time / fixed_time);
+        };
+
+        compare(
+            "multiply",
+            [](const auto& a, const auto& b) {
+                benchmarking::do_not_optimize(a * b);
+            },
+            [](auto a, auto b) {
+                benchmarking::do_not_optimize(algebra::matrix_multiply(a, b));
+            });
+        compare(
+            "determinant",
+            [](const auto& a, const auto&) {
+                benchmarking::do_not_optimize(algebra::fixed::determinant(a));
+            },
+            [](auto a, auto) {
+                auto lu{algorithms::lu_decomposition::factorize(a)};
+                benchmarking::do_not_optimize(lu->determinant());
+            });
+        compare(
+            "inverse",
+            [](const auto& a, const auto&) {
+                benchmarking::do_not_optimize(algebra::fixed::inverse(a));
+            },
+            [](auto a, auto) {
+                auto lu{algorithms::lu_decomposition::factorize(a)};
+                benchmarking::do_not_optimize(lu->inverse());
+            });
+        compare(
+            "solve",
+            [&](const auto& a, const auto&) {
+                benchmarking::do_not_optimize(algebra::fixed::solve(a, y));
+            },
+            [&](auto a, auto) {
+                auto lu{algorithms::lu_decomposition::factorize(a)};
+                benchmarking::do_not_optimize(lu->solve(y));
+            });
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937 generator{42};
+    std::println("{} matrices per batch, times in ms (best of {}), dynamic = "
+                 "matrix_multiply and lu_decomposition on matrix_view",
+                 batch,
+                 repetitions);
+    std::println("{:>3} {:>12} {:>12} {:>12} {:>9}",
+                 "n",
+                 "operation",
+                 "fixed",
+                 "dynamic",
+                 "speedup");
+    benchmark_size<2>(generator);
+    benchmark_size<3>(generator);
+    benchmark_size<4>(generator);
+    benchmark_size<6>(generator);
+    return 0;
+}
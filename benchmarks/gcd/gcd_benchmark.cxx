@@ -0,0 +1,136 @@
+#include <numeric>
+#include <print>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "euclidean.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+    constexpr std::size_t count{1 << 18};
+
+    using u128 = unsigned __int128;
+
+
+    auto euclid(u128 a, u128 b) -> u128 {
+        while (b != 0) { a = std::exchange(b, a % b); }
+        return a;
+    }
+
+
+    /*
+        description:
+            millions of gcds per second of random pairs below 2^(bits - 1),
+       so they fit in std::int64_t: std::gcd, the per-pair gcd_extended, binary_gcd, gcd_batch
+       and gcd_extended_batch
+    */
+    auto benchmark_64(int bits, std::mt19937_64& generator) -> void {
+        std::vector<std::uint64_t> as(count);
+        std::vector<std::uint64_t> bs(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            as[i] = generator() >> (65 - bits);
+            bs[i] = generator() >> (65 - bits);
+        }
+        const std::vector<std::int64_t> signed_as(as.begin(), as.end());
+        const std::vector<std::int64_t> signed_bs(bs.begin(), bs.end());
+        std::vector<std::uint64_t> results(count);
+        std::vector<algorithms::euclidean_result<std::int64_t, std::int64_t>>
+            extended(count);
+        const auto rate = [](double milliseconds) {
+            return static_cast<double>(count) / milliseconds / 1000.0;
+        };
+
+        const double standard{benchmarking::best_of(repetitions, [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                results[i] = std::gcd(as[i], bs[i]);
+            }
+            benchmarking::do_not_optimize(results);
+        })};
+        const double classic_extended{benchmarking::best_of(repetitions, [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                benchmarking::do_not_optimize(
+                    algorithms::gcd_extended(signed_as[i], signed_bs[i]));
+            }
+        })};
+        const double binary{benchmarking::best_of(repetitions, [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                results[i] = algorithms::binary_gcd(as[i], bs[i]);
+            }
+            benchmarking::do_not_optimize(results);
+        })};
+        const double batch{benchmarking::best_of(repetitions, [&] {
+            algorithms::gcd_batch<std::uint64_t>(as, bs, results);
+            benchmarking::do_not_optimize(results);
+        })};
+        const double extended_batch{benchmarking::best_of(repetitions, [&] {
+            algorithms::gcd_extended_batch(signed_as, signed_bs, extended);
+            benchmarking::do_not_optimize(extended);
+        })};
+        std::println("{:>5} {:>10.2f} {:>14.2f} {:>10.2f} {:>10.2f} {:>14.2f}",
+                     bits,
+                     rate(standard),
+                     rate(classic_extended),
+                     rate(binary),
+                     rate(batch),
+                     rate(extended_batch));
+    }
+
+
+    /*
+        description:
+            millions of gcds per second of random 128-bit pairs, Euclid with
+       128-bit divisions against lehmer_gcd
+    */
+    auto benchmark_128(std::mt19937_64& generator) -> void {
+        std::vector<u128> as(count);
+        std::vector<u128> bs(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            as[i] = static_cast<u128>(generator()) << 64 | generator();
+            bs[i] = static_cast<u128>(generator()) << 64 | generator();
+        }
+        std::vector<u128> results(count);
+        const auto rate = [](double milliseconds) {
+            return static_cast<double>(count) / milliseconds / 1000.0;
+        };
+        const double division{benchmarking::best_of(repetitions, [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                results[i] = euclid(as[i], bs[i]);
+            }
+            benchmarking::do_not_optimize(results);
+        })};
+        const double lehmer{benchmarking::best_of(repetitions, [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                results[i] = algorithms::lehmer_gcd(as[i], bs[i]);
+            }
+            benchmarking::do_not_optimize(results);
+        })};
+        std::println("{:>5} {:>10.2f} {:>10.2f}",
+                     128,
+                     rate(division),
+                     rate(lehmer));
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937_64 generator{42};
+    std::println("millions of gcds per second (best of {})\n", repetitions);
+    std::println("{:>5} {:>10} {:>14} {:>10} {:>10} {:>14}",
+                 "bits",
+                 "std::gcd",
+                 "gcd_extended",
+                 "binary",
+                 "batch",
+                 "extended batch");
+    for (int bits = 16; bits <= 64; bits += 16) {
+        benchmark_64(bits, generator);
+    }
+    std::println("\n{:>5} {:>10} {:>10}", "bits", "division", "lehmer");
+    benchmark_128(generator);
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <numeric>
+#include <print>
+#include <ranges>
+#include <set>
+#include <string_view>
+
+#include "recursion.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+
+    // every block starts with its size, the header keeps the default alignment
+    constexpr std::size_t header{alignof(std::max_align_t)};
+    std::size_t allocated{0};
+    std::size_t peak{0};
+
+
+    /*
+        description:
+            milliseconds until the first result and until the last one, bytes
+       allocated at most at a time while enumerating
+    */
+    struct measurement {
+        double first{std::numeric_limits<double>::max()};
+        double total{std::numeric_limits<double>::max()};
+        std::size_t peak{0};
+        std::size_t count{0};
+    };
+
+
+    /*
+        description:
+            enumerates the results of make() repetitions times, an eager
+       function has its first result when it returns and a generator when
+       begin() returns
+    */
+    template <typename Make>
+    auto measure(Make&& make) -> measurement {
+        measurement best{};
+        for (std::size_t i = 0; i < repetitions; ++i) {
+            const std::size_t base{allocated};
+            peak = allocated;
+            const auto start{std::chrono::steady_clock::now()};
+            auto results{make()};
+            auto it{std::ranges::begin(results)};
+            const auto first{std::chrono::steady_clock::now()};
+            std::size_t count{0};
+            for (; it != std::ranges::end(results); ++it) {
+                benchmarking::do_not_optimize(*it);
+                ++count;
+            }
+            const auto end{std::chrono::steady_clock::now()};
+            best.first = std::min(
+                best.first,
+                std::chrono::duration<double, std::milli>(first - start)
+                    .count());
+            best.total = std::min(
+                best.total,
+                std::chrono::duration<double, std::milli>(end - start)
+                    .count());
+            best.peak = peak - base;
+            best.count = count;
+        }
+        return best;
+    }
+
+
+    /*
+        description:
+            prints time to first result, total time and peak memory of an
+       eager enumerator and of its lazy counterpart
+    */
+    auto report(std::string_view name,
+                const measurement& eager,
+                const measurement& lazy) -> void {
+        const auto kibibytes = [](std::size_t bytes) {
+            return static_cast<double>(bytes) / 1024.0;
+        };
+        std::println(
+            "{:<34} {:>9} {:>10.3f} {:>10.3f} {:>10.2f} {:>10.2f} {:>12.1f} "
+            "{:>10.1f}",
+            name,
+            eager.count,
+            eager.first,
+            lazy.first,
+            eager.total,
+            lazy.total,
+            kibibytes(eager.peak),
+            kibibytes(lazy.peak));
+    }
+
+
+    /*
+        description:
+            the set {0, 1, ..., count - 1}
+    */
+    auto numbers(std::int32_t count) -> std::set<std::int32_t> {
+        std::set<std::int32_t> result;
+        for (std::int32_t i = 0; i < count; ++i) { result.insert(i); }
+        return result;
+    }
+
+}  // namespace
+
+
+auto operator new(std::size_t size) -> void* {
+    void* block{std::malloc(size + header)};
+    if (block == nullptr) { throw std::bad_alloc{}; }
+    *static_cast<std::size_t*>(block) = size;
+    allocated += size;
+    peak = std::max(peak, allocated);
+    return static_cast<char*>(block) + header;
+}
+
+
+auto operator delete(void* pointer) noexcept -> void {
+    if (pointer == nullptr) { return; }
+    void* block{static_cast<char*>(pointer) - header};
+    allocated -= *static_cast<std::size_t*>(block);
+    std::free(block);
+}
+
+
+auto operator delete(void* pointer, std::size_t /*size*/) noexcept -> void {
+    operator delete(pointer);
+}
+
+
+int main() {
+    const std::set<char> letters{'a', 'b', 'c', 'd'};
+    std::println("milliseconds and KiB at peak (best of {})\n", repetitions);
+    std::println(
+        "{:<34} {:>9} {:>10} {:>10} {:>10} {:>10} {:>12} {:>10}",
+        "enumeration",
+        "results",
+        "eager 1st",
+        "lazy 1st",
+        "eager all",
+        "lazy all",
+        "eager KiB",
+        "lazy KiB");
+    report("subsets, 20 numbers",
+           measure([&] { return subsets(numbers(20)); }),
+           measure([&] { return lazy_subsets(numbers(20)); }));
+    report("sequences_from_a_set, 4 letters, 10",
+           measure([&] { return sequences_from_a_set(letters, 10); }),
+           measure([&] { return lazy_sequences_from_a_set(letters, 10); }));
+    report("more_ones, 22 bits",
+           measure([] { return more_ones(22); }),
+           measure([] { return lazy_more_ones(22); }));
+    report("increasing_representations, 5",
+           measure([] { return increasing_representations(5); }),
+           measure([] { return lazy_increasing_representations(5); }));
+    report("non_increasing_decompositions, 50",
+           measure([] { return non_increasing_decompositions(50); }),
+           measure([] { return lazy_non_increasing_decompositions(50); }));
+    return 0;
+}
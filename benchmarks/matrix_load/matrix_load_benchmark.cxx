@@ -0,0 +1,81 @@
+#include <filesystem>
+#include <print>
+#include <random>
+#include <vector>
+
+#include "matrix.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+
+
+    /*
+        description:
+            the previous implementation of matrix::load: the whole file is read
+       into a string and parsed with nested std::views::split, kept as the
+       baseline
+    */
+    template <typename T>
+    auto split_load(const std::filesystem::path& file) -> std::vector<T> {
+        const std::string content{utils::load<char>(file)};
+        std::vector<T> values{};
+        for (auto&& row : content | std::views::split(std::views::single(';'))) {
+            std::ranges::copy(
+                row | std::views::split(std::views::single(',')) |
+                    std::views::transform([](auto&& value) {
+                        return utils::from_chars<T>(std::string_view{value});
+                    }),
+                std::back_inserter(values));
+        }
+        return values;
+    }
+
+
+    template <typename T>
+    auto benchmark_file(std::size_t n, std::mt19937& generator) -> void {
+        std::uniform_real_distribution<double> entries{-1000.0, 1000.0};
+        std::vector<T> values(n * n);
+        for (auto& value : values) { value = static_cast<T>(entries(generator)); }
+        ::ranges::matrix_view m(values, n, n, layout::row);
+        const auto file{std::filesystem::temp_directory_path() /
+                        "matrix_load_benchmark" / "matrix.csv"};
+        matrix::save<',', ';'>(m, file);
+        const auto megabytes{static_cast<double>(std::filesystem::file_size(file)) /
+                             1e6};
+
+        const double split_ms{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(split_load<T>(file));
+        })};
+        const double block_ms{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(matrix::load<T, ',', ';'>(file));
+        })};
+        std::println("{:>8} {:>6} {:>10.1f} {:>12.1f} {:>12.1f}",
+                     std::is_floating_point_v<T> ? "double" : "int",
+                     n,
+                     megabytes,
+                     megabytes / split_ms * 1000.0,
+                     megabytes / block_ms * 1000.0);
+        std::filesystem::remove_all(file.parent_path());
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937 generator{42};
+    std::println("parse throughput in MB/s (best of {})", repetitions);
+    std::println("{:>8} {:>6} {:>10} {:>12} {:>12}",
+                 "type",
+                 "n",
+                 "file MB",
+                 "split",
+                 "blocks");
+    for (const std::size_t n : {500, 1000, 2000, 4000}) {
+        benchmark_file<int>(n, generator);
+        benchmark_file<double>(n, generator);
+    }
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include <array>
+#include <cstdint>
+#include <print>
+#include <queue>
+#include <random>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "recursion.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+    // path_in_maze recurses once per cell of the path and copies the maze in
+    // every call, it overflows the stack long before these sizes
+    constexpr std::array<std::size_t, 3> sizes{1'024, 2'048, 4'096};
+
+
+    /*
+        description:
+            breadth-first search with std::queue of coordinates and a
+       std::vector<bool> of visited cells
+    */
+    auto queue_search(const std::vector<bool>& maze,
+                      std::size_t rows,
+                      std::size_t columns,
+                      std::size_t endx,
+                      std::size_t endy) -> bool {
+        std::vector<bool> visited(rows * columns);
+        std::queue<std::pair<std::size_t, std::size_t>> frontier;
+        frontier.emplace(0, 0);
+        visited[0] = true;
+        while (!frontier.empty()) {
+            const auto [x, y] = frontier.front();
+            frontier.pop();
+            if (x == endx && y == endy) { return true; }
+            const std::array<std::pair<std::size_t, std::size_t>, 4> moves{
+                {{x + 1, y}, {x - 1, y}, {x, y + 1}, {x, y - 1}}};
+            for (const auto& [next_x, next_y] : moves) {
+                if (next_x >= rows || next_y >= columns) { continue; }
+                const std::size_t next{next_x * columns + next_y};
+                if (maze[next] || visited[next]) { continue; }
+                visited[next] = true;
+                frontier.emplace(next_x, next_y);
+            }
+        }
+        return false;
+    }
+
+
+    /*
+        description:
+            n x n maze whose cells are walls with the given probability,
+       with open corners
+    */
+    auto random_maze(std::size_t n, double walls, std::mt19937& generator)
+        -> std::vector<bool> {
+        std::bernoulli_distribution wall{walls};
+        std::vector<bool> maze(n * n);
+        for (std::size_t i = 0; i < n * n; ++i) { maze[i] = wall(generator); }
+        maze.front() = false;
+        maze.back() = false;
+        return maze;
+    }
+
+
+    /*
+        description:
+            n x n maze of horizontal corridors joined at alternating ends, the
+       path between the corners runs through half of the cells
+    */
+    auto corridor_maze(std::size_t n) -> std::vector<bool> {
+        std::vector<bool> maze(n * n);
+        for (std::size_t x = 1; x < n; x += 2) {
+            for (std::size_t y = 0; y < n; ++y) { maze[x * n + y] = true; }
+            maze[x * n + ((x / 2) % 2 == 0 ? n - 1 : 0)] = false;
+        }
+        maze.back() = false;
+        return maze;
+    }
+
+
+    /*
+        description:
+            milliseconds of a search between the corners of a maze by
+       std::queue, by path_in_maze_bfs and by shortest_path_in_maze, and the
+       number of cells of the shortest path
+    */
+    auto benchmark_maze(std::string_view kind,
+                        const std::vector<bool>& maze,
+                        std::size_t n) -> void {
+        const int last{static_cast<int>(n - 1)};
+        const double queue{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(queue_search(maze, n, n, n - 1, n - 1));
+        })};
+        const double ring{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(
+                path_in_maze_bfs(maze, n, n, 0, 0, last, last));
+        })};
+        std::size_t length{0};
+        const double bits{benchmarking::best_of(repetitions, [&] {
+            length = shortest_path_in_maze(maze, n, n, 0, 0, last, last).size();
+            benchmarking::do_not_optimize(length);
+        })};
+        std::println("{:>6} {:>10} {:>12.2f} {:>12.2f} {:>12.2f} {:>10}",
+                     n,
+                     kind,
+                     queue,
+                     ring,
+                     bits,
+                     length);
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937 generator{42};
+    std::println("milliseconds (best of {}) between the corners of n x n mazes\n",
+                 repetitions);
+    std::println("{:>6} {:>10} {:>12} {:>12} {:>12} {:>10}",
+                 "n",
+                 "maze",
+                 "std::queue",
+                 "ring bfs",
+                 "bit bfs",
+                 "path");
+    for (const std::size_t n : sizes) {
+        benchmark_maze("open", random_maze(n, 0.1, generator), n);
+        benchmark_maze("random", random_maze(n, 0.3, generator), n);
+        benchmark_maze("corridors", corridor_maze(n), n);
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <print>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "Number_theory.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+    constexpr std::size_t count{1 << 18};
+
+
+    /*
+        description:
+            millions of operations per second of the template modular_pow and
+       modular_inverse, of runtime_modulus one value at a time and of its
+       batch pow and inverse, for the modulus mod
+    */
+    template <std::size_t mod>
+    auto benchmark_modulus(std::string_view reduction,
+                           std::mt19937_64& generator) -> void {
+        std::vector<std::uint64_t> values(count);
+        for (auto& v : values) { v = generator() % (mod / 2) * 2 + 1; }
+        std::vector<std::uint64_t> results(count);
+        const number_theory::runtime_modulus m{mod};
+        const std::uint64_t exponent{mod - 2};
+        const auto rate = [](double milliseconds) {
+            return static_cast<double>(count) / milliseconds / 1000.0;
+        };
+
+        const double template_pow{benchmarking::best_of(repetitions, [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                results[i] = number_theory::modular_pow<mod>(values[i], exponent);
+            }
+            benchmarking::do_not_optimize(results);
+        })};
+        const double runtime_pow{benchmarking::best_of(repetitions, [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                results[i] = m.pow(values[i], exponent);
+            }
+            benchmarking::do_not_optimize(results);
+        })};
+        const double batch_pow{benchmarking::best_of(repetitions, [&] {
+            m.pow(values, exponent, results);
+            benchmarking::do_not_optimize(results);
+        })};
+        std::println("{:>12} {:>9} {:>10} {:>14.2f} {:>14.2f} {:>14.2f}",
+                     mod,
+                     reduction,
+                     "pow",
+                     rate(template_pow),
+                     rate(runtime_pow),
+                     rate(batch_pow));
+
+        const double template_inverse{benchmarking::best_of(repetitions, [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                results[i] = static_cast<std::uint64_t>(
+                    number_theory::modular_inverse<mod>(values[i]));
+            }
+            benchmarking::do_not_optimize(results);
+        })};
+        const double runtime_inverse{benchmarking::best_of(repetitions, [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                results[i] = m.inverse(values[i]);
+            }
+            benchmarking::do_not_optimize(results);
+        })};
+        const double batch_inverse{benchmarking::best_of(repetitions, [&] {
+            m.inverse(values, results);
+            benchmarking::do_not_optimize(results);
+        })};
+        std::println("{:>12} {:>9} {:>10} {:>14.2f} {:>14.2f} {:>14.2f}",
+                     mod,
+                     reduction,
+                     "inverse",
+                     rate(template_inverse),
+                     rate(runtime_inverse),
+                     rate(batch_inverse));
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937_64 generator{42};
+    std::println("millions of operations per second (best of {})\n",
+                 repetitions);
+    std::println("{:>12} {:>9} {:>10} {:>14} {:>14} {:>14}",
+                 "modulus",
+                 "reduction",
+                 "operation",
+                 "template",
+                 "runtime",
+                 "batch");
+    benchmark_modulus<998'244'353>("montgomery", generator);
+    benchmark_modulus<1 << 30>("barrett", generator);
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <cstdint>
+#include <print>
+#include <random>
+#include <vector>
+
+#include "basic_algebra_2_pack.hpp"
+#include "modular_elimination.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{5};
+    constexpr std::size_t largest_fraction_size{12};
+    // small entries keep the fraction<int> elimination from overflowing for
+    // the sizes it is timed at
+    constexpr int entry_range{1};
+
+
+    /*
+        description:
+            random n x n matrix with a non-zero determinant
+    */
+    auto random_matrix(std::size_t n, std::mt19937& generator)
+        -> std::vector<int> {
+        std::uniform_int_distribution<int> entries{-entry_range, entry_range};
+        std::vector<int> values(n * n);
+        while (true) {
+            for (auto& value : values) { value = entries(generator); }
+            ::ranges::matrix_view m(values, n, n, layout::row);
+            const auto det{algorithms::modular_elimination::determinant(m)};
+            if (det.has_value() && *det != 0) { return values; }
+        }
+    }
+
+
+    /*
+        description:
+            compares the fraction<int> determinant and solve with their
+       multi-modular counterparts. fraction<int> overflows quickly, so it is
+       only timed for small sizes
+    */
+    auto benchmark_size(std::size_t n, std::mt19937& generator) -> void {
+        auto values{random_matrix(n, generator)};
+        std::vector<int> y(n, 1);
+        ::ranges::matrix_view m(values, n, n, layout::row);
+        if (!algorithms::modular_elimination::solve(m, y).has_value()) {
+            std::println("{:>5} solve failed, skipped", n);
+            return;
+        }
+
+        const double modular_det{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(
+                algorithms::modular_elimination::determinant(m));
+        })};
+        const double modular_solve{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(
+                algorithms::modular_elimination::solve(m, y));
+        })};
+        if (n > largest_fraction_size) {
+            std::println("{:>5} {:>16} {:>16.4f} {:>16} {:>16.4f}",
+                         n,
+                         "-",
+                         modular_det,
+                         "-",
+                         modular_solve);
+            return;
+        }
+        const double fraction_det{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(
+                algorithms::gaussian_elimination::determinant(m));
+        })};
+        const double fraction_solve{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(algebra::special_solution(m, y));
+        })};
+        std::println("{:>5} {:>16.4f} {:>16.4f} {:>16.4f} {:>16.4f}",
+                     n,
+                     fraction_det,
+                     modular_det,
+                     fraction_solve,
+                     modular_solve);
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937 generator{42};
+    std::println("times in ms (best of {})", repetitions);
+    std::println("{:>5} {:>16} {:>16} {:>16} {:>16}",
+                 "n",
+                 "det fraction",
+                 "det modular",
+                 "solve fraction",
+                 "solve modular");
+    for (const std::size_t n : {4, 8, 12, 16, 24, 32, 48, 64}) {
+        benchmark_size(n, generator);
+    }
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <cstdint>
+#include <format>
+#include <print>
+#include <string>
+#include <vector>
+
+#include "recursion.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+
+    // solve_n_queens_util stores every board and rescans the board for each
+    // square, beyond these sizes it takes minutes
+    constexpr int is_safe_limit{13};
+    constexpr int solutions_limit{15};
+    constexpr int sequential_limit{16};
+
+
+    /*
+        description:
+            milliseconds taken by solve_n_queens_util, by queens_solutions, by
+       the single threaded bitmask count of the whole board and by
+       count_queens, "-" where the size is over the limit of the solver
+    */
+    auto benchmark_queens(int n) -> void {
+        const auto cell = [&](int limit, auto&& solve) -> std::string {
+            if (n > limit) { return "-"; }
+            return std::format("{:.2f}",
+                               benchmarking::best_of(repetitions, solve));
+        };
+        const std::string is_safe{cell(is_safe_limit, [&] {
+            std::vector<std::vector<int>> solutions;
+            std::vector<int> board(n, -1);
+            solve_n_queens_util(n, 0, board, solutions);
+            benchmarking::do_not_optimize(solutions);
+        })};
+        const std::string solutions{cell(solutions_limit, [&] {
+            benchmarking::do_not_optimize(queens_solutions(n));
+        })};
+        const std::string sequential{cell(sequential_limit, [&] {
+            benchmarking::do_not_optimize(
+                count_n_queens_bitmask((1U << n) - 1, 0, 0, 0));
+        })};
+        std::uint64_t count{0};
+        const std::string parallel{cell(n, [&] {
+            count = count_queens(n);
+            benchmarking::do_not_optimize(count);
+        })};
+        std::println("{:>3} {:>11} {:>12} {:>12} {:>12} {:>12}",
+                     n,
+                     count,
+                     is_safe,
+                     solutions,
+                     sequential,
+                     parallel);
+    }
+
+}  // namespace
+
+
+int main() {
+    std::println("milliseconds (best of {})\n", repetitions);
+    std::println("{:>3} {:>11} {:>12} {:>12} {:>12} {:>12}",
+                 "n",
+                 "solutions",
+                 "is_safe",
+                 "bitmask",
+                 "sequential",
+                 "count");
+    for (int n = 8; n <= 18; ++n) { benchmark_queens(n); }
+    return 0;
+}
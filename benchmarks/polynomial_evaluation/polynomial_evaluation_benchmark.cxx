@@ -0,0 +1,79 @@
+#include <print>
+#include <random>
+#include <vector>
+
+#include "polynomial.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+
+    using field = polynomial::modular<998'244'353>;
+
+
+    template <typename T, typename Distribution>
+    auto random_values(std::size_t count,
+                       Distribution& entries,
+                       std::mt19937& generator) -> std::vector<T> {
+        std::vector<T> values(count);
+        for (auto& v : values) { v = T(entries(generator)); }
+        return values;
+    }
+
+
+    /*
+        description:
+            millions of points per second of the scalar loop over operator()
+       and of the batch evaluate() for a polynomial with the given number of
+       coefficients
+    */
+    template <typename T, typename Distribution>
+    auto benchmark_points(std::size_t coefficients,
+                          std::size_t points,
+                          Distribution& entries,
+                          std::mt19937& generator) -> void {
+        auto p{polynomial::polynomial<T>{
+            random_values<T>(coefficients, entries, generator),
+            coefficients - 1}};
+        const auto x{random_values<T>(points, entries, generator)};
+        std::vector<T> results(points);
+        const double scalar{benchmarking::best_of(repetitions, [&] {
+            for (std::size_t i = 0; i < points; ++i) { results[i] = p(x[i]); }
+            benchmarking::do_not_optimize(results);
+        })};
+        const double batch{benchmarking::best_of(repetitions, [&] {
+            p.evaluate(std::span<const T>{x}, std::span<T>{results});
+            benchmarking::do_not_optimize(results);
+        })};
+        const auto rate = [&](double milliseconds) {
+            return static_cast<double>(points) / milliseconds / 1000.0;
+        };
+        std::println("{:>7} {:>9} {:>14.2f} {:>14.2f}",
+                     coefficients,
+                     points,
+                     rate(scalar),
+                     rate(batch));
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> reals{-1.0, 1.0};
+    std::uniform_int_distribution<std::uint32_t> residues{};
+    std::println("millions of points per second (best of {})\n", repetitions);
+    std::println("double");
+    std::println("{:>7} {:>9} {:>14} {:>14}", "n", "points", "scalar", "batch");
+    for (std::size_t n = 4; n <= 1024; n *= 4) {
+        benchmark_points<double>(n, 1 << 20, reals, generator);
+    }
+    std::println("\nmodular, points = coefficients");
+    std::println("{:>7} {:>9} {:>14} {:>14}", "n", "points", "scalar", "batch");
+    for (std::size_t n = 256; n <= 65'536; n *= 4) {
+        benchmark_points<field>(n, n, residues, generator);
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include <print>
+#include <random>
+#include <vector>
+
+#include "polynomial.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+
+    using field = polynomial::modular<998'244'353>;
+
+
+    template <typename T, typename Distribution>
+    auto random_polynomial(std::size_t degree,
+                           Distribution& entries,
+                           std::mt19937& generator)
+        -> polynomial::polynomial<T> {
+        std::vector<T> coefficients(degree + 1);
+        for (auto& c : coefficients) { c = T(entries(generator)); }
+        if (coefficients.back() == T{0}) { coefficients.back() = T{1}; }
+        return {coefficients, degree};
+    }
+
+
+    /*
+        description:
+            division of a polynomial of degree 2n by one of degree n, long
+       division (double coefficients) against Newton inversion (modular)
+    */
+    auto benchmark_division(std::size_t n, std::mt19937& generator) -> void {
+        std::uniform_int_distribution<std::uint32_t> entries{1, 1000};
+        const auto a{random_polynomial<double>(2 * n, entries, generator)};
+        const auto b{random_polynomial<double>(n, entries, generator)};
+        const auto c{random_polynomial<field>(2 * n, entries, generator)};
+        const auto d{random_polynomial<field>(n, entries, generator)};
+        const double long_division{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(a / b);
+        })};
+        const double newton{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(c / d);
+        })};
+        std::println("{:>7} {:>14.3f} {:>14.3f}", n, long_division, newton);
+    }
+
+
+    /*
+        description:
+            gcd of two modular polynomials of degree n with a common factor of
+       degree n / 4, Euclidean gcd against the half-gcd fast_gcd
+    */
+    auto benchmark_modular_gcd(std::size_t n, std::mt19937& generator)
+        -> void {
+        std::uniform_int_distribution<std::uint32_t> entries{};
+        const auto common{random_polynomial<field>(n / 4, entries, generator)};
+        const auto a{random_polynomial<field>(n - n / 4, entries, generator) *
+                     common};
+        const auto b{
+            random_polynomial<field>(n - n / 4 - 1, entries, generator) *
+            common};
+        const double euclidean{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(polynomial::gcd(a, b));
+        })};
+        const double half_gcd{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(polynomial::fast_gcd(a, b));
+        })};
+        std::println("{:>7} {:>14.3f} {:>14.3f}", n, euclidean, half_gcd);
+    }
+
+
+    /*
+        description:
+            multi-prime fast_gcd of two integer polynomials of degree n with
+       a common factor. There is no Euclidean baseline: over the integers the
+       remainders need fractions, and over doubles the existing gcd breaks
+       down on rounding errors
+    */
+    auto benchmark_integer_gcd(std::size_t n, std::mt19937& generator)
+        -> void {
+        std::uniform_int_distribution<int> entries{-100, 100};
+        const auto common{
+            random_polynomial<long long>(n / 4, entries, generator)};
+        const auto a{
+            random_polynomial<long long>(n - n / 4, entries, generator) *
+            common};
+        const auto b{
+            random_polynomial<long long>(n - n / 4 - 1, entries, generator) *
+            common};
+        const double multi_prime{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(polynomial::fast_gcd(a, b));
+        })};
+        std::println("{:>7} {:>14.3f}", n, multi_prime);
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937 generator{42};
+    std::println("times in ms (best of {})\n", repetitions);
+    std::println("{:>7} {:>14} {:>14}", "n", "long division", "newton");
+    for (std::size_t n = 256; n <= 32'768; n *= 2) {
+        benchmark_division(n, generator);
+    }
+    std::println("\n{:>7} {:>14} {:>14}", "n", "euclidean gcd", "half-gcd");
+    for (std::size_t n = 256; n <= 16'384; n *= 2) {
+        benchmark_modular_gcd(n, generator);
+    }
+    std::println("\n{:>7} {:>14}", "n", "multi-prime");
+    for (std::size_t n = 16; n <= 1024; n *= 2) {
+        benchmark_integer_gcd(n, generator);
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <print>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "polynomial.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{5};
+    // the schoolbook product is quadratic, it is not run above this length
+    constexpr std::size_t schoolbook_limit{16384};
+
+
+    auto random_coefficients(std::size_t n, std::mt19937& generator)
+        -> std::vector<long long> {
+        std::uniform_int_distribution<long long> entries{-1000, 1000};
+        std::vector<long long> coefficients(n);
+        for (auto& c : coefficients) { c = entries(generator); }
+        return coefficients;
+    }
+
+
+    /*
+        description:
+            times every strategy on two factors of n coefficients, the
+       crossover points are the lengths at which the fastest column changes
+    */
+    auto benchmark_size(std::size_t n, std::mt19937& generator) -> void {
+        namespace multiplication = polynomial::multiplication;
+        const auto a{random_coefficients(n, generator)};
+        const auto b{random_coefficients(n, generator)};
+        const std::span<const long long> x{a};
+        const std::span<const long long> y{b};
+
+        double schoolbook{0.0};
+        if (n <= schoolbook_limit) {
+            schoolbook = benchmarking::best_of(repetitions, [&] {
+                std::vector<long long> product(2 * n - 1, 0);
+                multiplication::schoolbook(x, y, std::span{product});
+                benchmarking::do_not_optimize(product);
+            });
+        }
+        const double karatsuba{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(multiplication::karatsuba(x, y));
+        })};
+        const double ntt{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(multiplication::ntt(x, y));
+        })};
+        const double dispatched{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(multiplication::multiply(x, y));
+        })};
+        std::println("{:>7} {:>12.4f} {:>12.4f} {:>12.4f} {:>12.4f}",
+                     n,
+                     schoolbook,
+                     karatsuba,
+                     ntt,
+                     dispatched);
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937 generator{42};
+    std::println("times in ms (best of {}) of multiplying two polynomials with "
+                 "n coefficients, schoolbook is skipped (0) above {}",
+                 repetitions,
+                 schoolbook_limit);
+    std::println("thresholds: karatsuba {}, ntt {}",
+                 polynomial::multiplication::karatsuba_threshold,
+                 polynomial::multiplication::ntt_threshold);
+    std::println("{:>7} {:>12} {:>12} {:>12} {:>12}",
+                 "n",
+                 "schoolbook",
+                 "karatsuba",
+                 "ntt",
+                 "multiply");
+    for (std::size_t n = 8; n <= 262'144; n *= 2) {
+        benchmark_size(n, generator);
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <print>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "polynomial.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+
+    using root = std::pair<long long, long long>;
+
+
+    /*
+        description:
+            positive divisors of n by trial division up to its square root
+    */
+    auto trial_divisors(std::uint64_t n) -> std::vector<std::uint64_t> {
+        std::vector<std::uint64_t> result{};
+        for (std::uint64_t d = 1; d * d <= n; ++d) {
+            if (n % d == 0) {
+                result.push_back(d);
+                if (d * d != n) { result.push_back(n / d); }
+            }
+        }
+        return result;
+    }
+
+
+    /*
+        description:
+            the baseline: divisors by trial division and every candidate
+       tried in turn by exact synthetic division, without modular pruning
+    */
+    auto trial_division_roots(std::vector<long long> a) -> std::vector<root> {
+        namespace search = polynomial::rational_root_search;
+        std::vector<root> roots{};
+        const auto numerators{trial_divisors(search::magnitude(a.front()))};
+        const auto denominators{trial_divisors(search::magnitude(a.back()))};
+        for (const std::uint64_t q : denominators) {
+            for (const std::uint64_t p : numerators) {
+                if (std::gcd(p, q) != 1) { continue; }
+                for (const long long sign : {1LL, -1LL}) {
+                    const root candidate{sign * static_cast<long long>(p),
+                                         static_cast<long long>(q)};
+                    while (a.size() > 1 &&
+                           search::deflate(a, candidate.first, candidate.second)) {
+                        roots.push_back(candidate);
+                    }
+                }
+            }
+        }
+        return roots;
+    }
+
+
+    /*
+        description:
+            (2x - 1)(3x + 4)(x - 5)(7x + 2) times a polynomial of the given
+       degree with small random coefficients and the given extreme ones
+    */
+    auto test_polynomial(std::size_t degree,
+                         long long constant,
+                         long long leading,
+                         std::mt19937& generator) -> std::vector<long long> {
+        std::uniform_int_distribution<long long> entries{-3, 3};
+        std::vector<long long> a(degree + 1);
+        for (auto& c : a) { c = entries(generator); }
+        a.front() = constant;
+        a.back() = leading;
+        for (const auto& [p, q] : std::vector<root>{{1, 2}, {-4, 3}, {5, 1}, {-2, 7}}) {
+            std::vector<long long> product(a.size() + 1, 0);
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                product[i] -= p * a[i];
+                product[i + 1] += q * a[i];
+            }
+            a = std::move(product);
+        }
+        return a;
+    }
+
+
+    /*
+        description:
+            milliseconds of the baseline and of rational_roots on one
+       polynomial, the two have to find the same roots
+    */
+    auto benchmark_roots(std::size_t degree,
+                         long long constant,
+                         long long leading,
+                         std::mt19937& generator) -> void {
+        const auto a{test_polynomial(degree, constant, leading, generator)};
+        const polynomial::polynomial<long long> p{a, a.size() - 1};
+        std::vector<root> expected{};
+        std::vector<root> found{};
+        const double baseline{benchmarking::best_of(repetitions, [&] {
+            expected = trial_division_roots(a);
+        })};
+        const double search{benchmarking::best_of(repetitions, [&] {
+            found = polynomial::rational_roots(p);
+        })};
+        std::ranges::sort(expected, [](const root& x, const root& y) {
+            return x.first * y.second < y.first * x.second;
+        });
+        std::println("{:>7} {:>14} {:>10} {:>7} {:>12.2f} {:>12.2f} {:>8}",
+                     degree,
+                     constant,
+                     leading,
+                     found.size(),
+                     baseline,
+                     search,
+                     found == expected ? "yes" : "no");
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937 generator{42};
+    std::println("milliseconds to find the rational roots (best of {})\n", repetitions);
+    std::println("{:>7} {:>14} {:>10} {:>7} {:>12} {:>12} {:>8}",
+                 "degree",
+                 "constant",
+                 "leading",
+                 "roots",
+                 "baseline",
+                 "pruned",
+                 "agree");
+    for (std::size_t degree = 128; degree <= 8192; degree *= 4) {
+        benchmark_roots(degree, 720'720, 5'040, generator);
+        benchmark_roots(degree, 999'999'000'001, 97, generator);
+    }
+    return 0;
+}
@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <print>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "big_integer.hpp"
+#include "representation.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+    /*the quadratic conversions are not run past these*/
+    constexpr std::size_t naive_period_limit{20'000};
+    constexpr std::size_t naive_digits_limit{100'000};
+    constexpr std::size_t naive_fraction_limit{10'000};
+
+    constexpr std::uint8_t decimal{10};
+
+    using number_theory::big_integer;
+
+
+    /*
+        description:
+            the previous expand_fractional_part: one digit at a time,
+       looking each remainder up in the list of those seen before
+    */
+    template <std::uint8_t base, typename I>
+    auto list_expansion(const I& numerator, const I& denominator)
+        -> std::pair<std::string, std::string> {
+        std::vector<I> seen;
+        std::string digits;
+        I remainder{numerator % denominator};
+        while (remainder != I{0} && std::ranges::find(seen, remainder) == seen.end()) {
+            seen.push_back(remainder);
+            remainder *= I{base};
+            digits.push_back(representation::digit_symbol(
+                static_cast<std::uint64_t>(remainder / denominator), true));
+            remainder %= denominator;
+        }
+        if (remainder == I{0}) { return {digits, ""}; }
+        const auto index{static_cast<std::size_t>(
+            std::ranges::find(seen, remainder) - seen.begin())};
+        return {digits.substr(0, index), digits.substr(index)};
+    }
+
+
+    /*
+        description:
+            the digits of value peeled off one at a time by dividing the
+       whole number by base
+    */
+    template <std::uint8_t base>
+    auto digit_by_digit(big_integer value) -> std::string {
+        std::string reversed;
+        do {
+            reversed.push_back(representation::digit_symbol(
+                static_cast<std::uint64_t>(value % big_integer{base}), false));
+            value /= big_integer{base};
+        } while (value != big_integer{0});
+        return {reversed.rbegin(), reversed.rend()};
+    }
+
+
+    auto cell(double milliseconds) -> std::string {
+        return milliseconds < 0 ? std::string{"-"} : std::format("{:.2f}", milliseconds);
+    }
+
+
+    /*
+        description:
+            milliseconds of expanding 1 / p, whose period has p - 1 digits
+       since 10 is a primitive root modulo p, with the multiplicative order
+       and with the list of seen remainders
+    */
+    auto benchmark_period(std::int64_t p) -> void {
+        const representation::fraction<std::int64_t> fraction{1, p};
+        const double order{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(representation::expand<decimal>(fraction));
+        })};
+        double list{-1};
+        if (static_cast<std::size_t>(p) <= naive_period_limit) {
+            list = benchmarking::best_of(repetitions, [&] {
+                benchmarking::do_not_optimize(list_expansion<decimal>(std::int64_t{1}, p));
+            });
+        }
+        std::println("{:>9} {:>12.2f} {:>12}", p, order, cell(list));
+    }
+
+
+    /*
+        description:
+            milliseconds of expanding a whole number of the given number of
+       digits by divide and conquer and digit by digit
+    */
+    auto benchmark_whole(std::size_t digits, std::mt19937_64& generator) -> void {
+        std::uniform_int_distribution<int> digit{0, 9};
+        std::string text(digits, '0');
+        std::ranges::generate(text, [&] { return static_cast<char>('0' + digit(generator)); });
+        text.front() = '7';
+        const big_integer value{text};
+        const double divide_and_conquer{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(representation::expand_whole<decimal>(value));
+        })};
+        double naive{-1};
+        if (digits <= naive_digits_limit) {
+            naive = benchmarking::best_of(repetitions, [&] {
+                benchmarking::do_not_optimize(digit_by_digit<decimal>(value));
+            });
+        }
+        std::println("{:>9} {:>12.2f} {:>12}", digits, divide_and_conquer, cell(naive));
+    }
+
+
+    /*
+        description:
+            milliseconds of expanding 1 / 2^k, which has k decimal digits
+       after the point, by one division with divide and conquer conversion
+       and one digit at a time
+    */
+    auto benchmark_terminating(std::size_t k) -> void {
+        const representation::fraction<big_integer> fraction{big_integer{1},
+                                                             big_integer{1} << k};
+        const double block{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(representation::expand<decimal>(fraction));
+        })};
+        double list{-1};
+        if (k <= naive_fraction_limit) {
+            list = benchmarking::best_of(repetitions, [&] {
+                benchmarking::do_not_optimize(
+                    list_expansion<decimal>(fraction.numerator, fraction.denominator));
+            });
+        }
+        std::println("{:>9} {:>12.2f} {:>12}", k, block, cell(list));
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937_64 generator{42};
+    std::println("milliseconds (best of {})\n", repetitions);
+    std::println("period of 1 / p");
+    std::println("{:>9} {:>12} {:>12}", "p", "order", "list");
+    for (const std::int64_t p : {1'019, 10'007, 100'019, 1'000'171}) { benchmark_period(p); }
+    std::println("\nwhole part");
+    std::println("{:>9} {:>12} {:>12}", "digits", "d&c", "by digit");
+    for (std::size_t digits = 1'000; digits <= 1'000'000; digits *= 10) {
+        benchmark_whole(digits, generator);
+    }
+    std::println("\n1 / 2^k");
+    std::println("{:>9} {:>12} {:>12}", "k", "block", "list");
+    for (std::size_t k = 1'000; k <= 1'000'000; k *= 10) { benchmark_terminating(k); }
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include <print>
+#include <vector>
+
+#include "gaussian_elimination.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    using algorithms::gaussian_elimination::fraction;
+
+    constexpr std::size_t repetitions{5};
+    constexpr std::size_t updates{1000};
+
+
+    /*
+        description:
+            row_k -= factor * row_i as one fused loop over the row
+    */
+    template <typename T>
+    auto fused(std::vector<T>& values, std::size_t columns, T factor)
+        -> void {
+        ::ranges::matrix_view m(values, 2, columns, layout::row);
+        for (std::size_t u = 0; u < updates; ++u) {
+            m[1] -= factor * m[0];
+            m[1] += factor * m[0];
+        }
+    }
+
+
+    /*
+        description:
+            the same update written with compound operators only: a scaled
+       copy of row_i is built first and subtracted in a second pass
+    */
+    template <typename T>
+    auto unfused(std::vector<T>& values, std::size_t columns, T factor)
+        -> void {
+        ::ranges::matrix_view m(values, 2, columns, layout::row);
+        std::vector<T> scaled(columns);
+        for (std::size_t u = 0; u < updates; ++u) {
+            std::ranges::copy(m[0], scaled.begin());
+            ::ranges::numeric_view{scaled} *= factor;
+            m[1] -= scaled;
+            m[1] += scaled;
+        }
+    }
+
+
+    template <typename T>
+    auto benchmark_type(std::string_view name, T one, T factor) -> void {
+        for (const std::size_t columns : {16, 256, 4096}) {
+            std::vector<T> values(2 * columns, one);
+            const double fused_ms{benchmarking::best_of(repetitions, [&] {
+                fused(values, columns, factor);
+                benchmarking::do_not_optimize(values);
+            })};
+            const double unfused_ms{benchmarking::best_of(repetitions, [&] {
+                unfused(values, columns, factor);
+                benchmarking::do_not_optimize(values);
+            })};
+            std::println("{:>14} {:>8} {:>12.3f} {:>12.3f} {:>8.2f}",
+                         name,
+                         columns,
+                         fused_ms,
+                         unfused_ms,
+                         unfused_ms / fused_ms);
+        }
+    }
+
+}  // namespace
+
+
+int main() {
+    std::println("times in ms of {} row updates (best of {})",
+                 2 * updates,
+                 repetitions);
+    std::println("{:>14} {:>8} {:>12} {:>12} {:>8}",
+                 "type",
+                 "columns",
+                 "fused",
+                 "unfused",
+                 "speedup");
+    benchmark_type<double>("double", 1.0, 0.5);
+    benchmark_type<fraction<int>>("fraction<int>", {1, 1}, {1, 2});
+    return 0;
+}
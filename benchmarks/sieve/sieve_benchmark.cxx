@@ -0,0 +1,65 @@
+#include <print>
+#include <vector>
+
+#include "Number_theory.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+
+    // sieve_of_eratosthenes keeps a bit per number, beyond this it needs too much memory
+    constexpr std::uint64_t eratosthenes_limit{1'000'000'000};
+
+
+    /*
+        description:
+            millions of primes per second of sieve_of_eratosthenes and of
+       segmented_sieve counting the primes below up_to through its callback
+    */
+    auto benchmark_sieve(std::uint64_t up_to) -> void {
+        std::uint64_t count{0};
+        const double segmented{benchmarking::best_of(repetitions, [&] {
+            count = 0;
+            number_theory::segmented_sieve(up_to,
+                                           [&](std::uint64_t) { ++count; });
+            benchmarking::do_not_optimize(count);
+        })};
+        const auto rate = [&](double milliseconds) {
+            return static_cast<double>(count) / milliseconds / 1000.0;
+        };
+        if (up_to > eratosthenes_limit) {
+            std::println("{:>14} {:>12} {:>14} {:>14.2f}",
+                         up_to,
+                         count,
+                         "-",
+                         rate(segmented));
+            return;
+        }
+        const double eratosthenes{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(
+                number_theory::sieve_of_eratosthenes(up_to));
+        })};
+        std::println("{:>14} {:>12} {:>14.2f} {:>14.2f}",
+                     up_to,
+                     count,
+                     rate(eratosthenes),
+                     rate(segmented));
+    }
+
+}  // namespace
+
+
+int main() {
+    std::println("millions of primes per second (best of {})\n", repetitions);
+    std::println("{:>14} {:>12} {:>14} {:>14}",
+                 "up to",
+                 "primes",
+                 "eratosthenes",
+                 "segmented");
+    for (std::uint64_t up_to = 1'000'000; up_to <= 10'000'000'000; up_to *= 10) {
+        benchmark_sieve(up_to);
+    }
+    return 0;
+}
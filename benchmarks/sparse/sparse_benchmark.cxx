@@ -0,0 +1,118 @@
+#include <print>
+#include <random>
+#include <vector>
+
+#include "basic_algebra_2_pack.hpp"
+#include "lu_decomposition.hpp"
+#include "sparse_matrix.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{5};
+    constexpr std::size_t size{2000};
+    constexpr std::size_t right_hand_sides{16};
+
+
+    /*
+        description:
+            random n x n matrix with the given density of non-zeros and a
+       dominant diagonal, so that every system in the benchmark is solvable
+    */
+    auto random_matrix(std::size_t n, double density, std::mt19937& generator)
+        -> std::vector<double> {
+        std::uniform_real_distribution<double> unit{0.0, 1.0};
+        std::uniform_real_distribution<double> entries{-1.0, 1.0};
+        std::vector<double> values(n * n, 0.0);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                if (unit(generator) < density) {
+                    values[i * n + j] = entries(generator);
+                }
+            }
+            values[i * n + i] = 2.0 + density * static_cast<double>(n);
+        }
+        return values;
+    }
+
+
+    auto dense_multiply_vector(::ranges::matrix_view<double, std::layout_right> m,
+                               const std::vector<double>& x)
+        -> std::vector<double> {
+        std::vector<double> y(m.number_of_rows(), 0.0);
+        for (std::size_t i = 0; i < m.number_of_rows(); ++i) {
+            for (std::size_t j = 0; j < m.number_of_columns(); ++j) {
+                y[i] += m[i, j] * x[j];
+            }
+        }
+        return y;
+    }
+
+
+    auto benchmark_density(double density, std::mt19937& generator) -> void {
+        auto values{random_matrix(size, density, generator)};
+        ::ranges::matrix_view m(values, size, size, layout::row);
+        const auto csr{algebra::sparse::to_compressed<std::layout_right>(m)};
+        std::vector<double> x(size, 1.0);
+        std::vector<double> rhs_values(size * right_hand_sides, 1.0);
+        ::ranges::matrix_view rhs(
+            rhs_values, size, right_hand_sides, layout::row);
+
+        const double spmv_dense{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(dense_multiply_vector(m, x));
+        })};
+        const double spmv_sparse{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(
+                algebra::sparse::multiply(csr, std::span<const double>{x}));
+        })};
+        const double spmm_dense{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(algebra::matrix_multiply(m, rhs));
+        })};
+        const double spmm_sparse{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(algebra::sparse::multiply(csr, rhs));
+        })};
+        const double solve_dense{benchmarking::best_of(repetitions, [&] {
+            auto lu{algorithms::lu_decomposition::factorize(m).value()};
+            benchmarking::do_not_optimize(lu.solve(x));
+        })};
+        const double solve_sparse{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(algebra::sparse::solve(csr, x));
+        })};
+        std::println("{:>8.4f} {:>10} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f} "
+                     "{:>10.3f} {:>10.3f}",
+                     density,
+                     csr.non_zeros(),
+                     spmv_dense,
+                     spmv_sparse,
+                     spmm_dense,
+                     spmm_sparse,
+                     solve_dense,
+                     solve_sparse);
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937 generator{42};
+    std::println("{} x {} matrices, SpMM with {} right-hand sides, times in ms "
+                 "(best of {}), dense solve is a blocked LU",
+                 size,
+                 size,
+                 right_hand_sides,
+                 repetitions);
+    std::println("{:>8} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10}",
+                 "density",
+                 "non-zeros",
+                 "mv dense",
+                 "mv sparse",
+                 "mm dense",
+                 "mm sparse",
+                 "lu dense",
+                 "lu sparse");
+    for (const double density : {0.0005, 0.001, 0.005, 0.01, 0.05, 0.1}) {
+        benchmark_density(density, generator);
+    }
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include <print>
+#include <random>
+#include <vector>
+
+#include "gaussian_elimination.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    namespace ge = algorithms::gaussian_elimination;
+
+    constexpr std::size_t repetitions{5};
+    constexpr std::size_t eliminations_per_run{200};
+
+
+    /*
+        description:
+            matrix with entries in {0, 1} on the diagonal and below, so the
+       fractions produced by the elimination stay small enough for int
+    */
+    auto random_matrix(std::size_t n, std::mt19937& generator)
+        -> std::vector<int> {
+        std::bernoulli_distribution bit{0.5};
+        std::vector<int> values(n * n, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            values[i * n + i] = 1;
+            for (std::size_t j = 0; j < i; ++j) {
+                values[i * n + j] = bit(generator) ? 1 : 0;
+            }
+        }
+        return values;
+    }
+
+
+    /*
+        description:
+            number of eliminations to diagonal form per second with recording
+       policy Recorder
+    */
+    template <typename Recorder>
+    auto throughput(::ranges::matrix_view<int, std::layout_right> m) -> double {
+        const double ms{benchmarking::best_of(repetitions, [&] {
+            for (std::size_t i = 0; i < eliminations_per_run; ++i) {
+                benchmarking::do_not_optimize(
+                    ge::gaussian_elimiantion_alg<Recorder>(
+                        m, ge::reducted_form::diagonal));
+            }
+        })};
+        return static_cast<double>(eliminations_per_run) * 1000.0 / ms;
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937 generator{42};
+    std::println("eliminations per second (best of {})", repetitions);
+    std::println("{:>5} {:>16} {:>16} {:>16}",
+                 "n",
+                 "none",
+                 "operation_log",
+                 "formatted");
+    for (const std::size_t n : {4, 8, 16, 32}) {
+        auto values{random_matrix(n, generator)};
+        ::ranges::matrix_view m(values, n, n, layout::row);
+        std::println("{:>5} {:>16.0f} {:>16.0f} {:>16.0f}",
+                     n,
+                     throughput<ge::step_recording::none>(m),
+                     throughput<ge::step_recording::operation_log>(m),
+                     throughput<ge::step_recording::formatted>(m));
+    }
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include <format>
+#include <numeric>
+#include <print>
+#include <string>
+#include <vector>
+
+#include "Number_theory.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{3};
+
+
+    /*
+        description:
+            the previous euler_totient, counts i <= value coprime to value
+    */
+    auto gcd_count_totient(std::uint64_t value) -> std::uint64_t {
+        std::uint64_t result{0};
+        for (std::uint64_t i = 1; i <= value; ++i) {
+            if (std::gcd(i, value) == 1) { ++result; }
+        }
+        return result;
+    }
+
+
+    /*
+        description:
+            millions of totients per second for every n <= up_to: the gcd
+       count (only for small up_to), euler_totient from the factorization
+       and multiplicative_function_tables
+    */
+    auto benchmark_totients(std::uint64_t up_to) -> void {
+        const auto rate = [&](double milliseconds) {
+            return static_cast<double>(up_to) / milliseconds / 1000.0;
+        };
+        std::string gcd_count_rate{"-"};
+        if (up_to <= 10'000) {
+            const double gcd_count{benchmarking::best_of(repetitions, [&] {
+                for (std::uint64_t n = 1; n <= up_to; ++n) {
+                    benchmarking::do_not_optimize(gcd_count_totient(n));
+                }
+            })};
+            gcd_count_rate = std::format("{:.3f}", rate(gcd_count));
+        }
+        const double factorization{benchmarking::best_of(repetitions, [&] {
+            for (std::uint64_t n = 1; n <= up_to; ++n) {
+                benchmarking::do_not_optimize(number_theory::euler_totient(n));
+            }
+        })};
+        const double tables{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(
+                number_theory::multiplicative_function_tables(up_to));
+        })};
+        std::println("{:>12} {:>14} {:>14.3f} {:>14.3f}",
+                     up_to,
+                     gcd_count_rate,
+                     rate(factorization),
+                     rate(tables));
+    }
+
+}  // namespace
+
+
+int main() {
+    std::println("millions of totients per second (best of {})\n", repetitions);
+    std::println("{:>12} {:>14} {:>14} {:>14}",
+                 "up to",
+                 "gcd count",
+                 "factorization",
+                 "tables");
+    for (std::uint64_t up_to = 10'000; up_to <= 100'000'000; up_to *= 10) {
+        benchmark_totients(up_to);
+    }
+    return 0;
+}
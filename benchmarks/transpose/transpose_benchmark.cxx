@@ -0,0 +1,107 @@
+#include <print>
+#include <random>
+#include <vector>
+
+#include "gaussian_elimination.hpp"
+#include "timer.hpp"
+
+
+namespace {
+
+    constexpr std::size_t repetitions{5};
+
+
+    auto random_matrix(std::size_t n, std::mt19937& generator)
+        -> std::vector<double> {
+        std::uniform_real_distribution<double> entries{-1.0, 1.0};
+        std::vector<double> values(n * n);
+        for (auto& value : values) { value = entries(generator); }
+        return values;
+    }
+
+
+    /*
+        description:
+            transposition written the straightforward way, row by row of the
+       source, used as the baseline for ranges::transpose_copy
+    */
+    auto naive_transpose_copy(
+        ::ranges::matrix_view<double, std::layout_right> m)
+        -> std::vector<double> {
+        const std::size_t rows{m.number_of_rows()};
+        const std::size_t columns{m.number_of_columns()};
+        std::vector<double> values(rows * columns);
+        for (std::size_t i = 0; i < rows; ++i) {
+            for (std::size_t j = 0; j < columns; ++j) {
+                values[j * rows + i] = m[i, j];
+            }
+        }
+        return values;
+    }
+
+
+    /*
+        description:
+            row-wise algorithm used to compare strided and contiguous access:
+       subtracts half of the first row from every other row
+    */
+    template <typename LP>
+    auto row_sweep(::ranges::matrix_view<double, LP> m) -> void {
+        for (std::size_t k = 1; k < m.number_of_rows(); ++k) {
+            algorithms::gaussian_elimination::subtract(m, k, 0, 0.5);
+        }
+    }
+
+
+    auto benchmark_size(std::size_t n, std::mt19937& generator) -> void {
+        auto values{random_matrix(n, generator)};
+        ::ranges::matrix_view m(values, n, n, layout::row);
+
+        const double naive{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(naive_transpose_copy(m));
+        })};
+        const double tiled{benchmarking::best_of(repetitions, [&] {
+            benchmarking::do_not_optimize(::ranges::transpose_copy(m));
+        })};
+        const double in_place{benchmarking::best_of(repetitions, [&] {
+            ::ranges::transpose_in_place(m);
+            benchmarking::do_not_optimize(values);
+        })};
+        const double sweep_view{benchmarking::best_of(repetitions, [&] {
+            row_sweep(::ranges::transpose(m));
+            benchmarking::do_not_optimize(values);
+        })};
+        const double sweep_copy{benchmarking::best_of(repetitions, [&] {
+            auto [copy, transposed] = ::ranges::transpose_copy(m);
+            row_sweep(transposed);
+            benchmarking::do_not_optimize(copy);
+        })};
+        std::println("{:>6} {:>12.3f} {:>12.3f} {:>12.3f} {:>14.3f} {:>14.3f}",
+                     n,
+                     naive,
+                     tiled,
+                     in_place,
+                     sweep_view,
+                     sweep_copy);
+    }
+
+}  // namespace
+
+
+int main() {
+    std::mt19937 generator{42};
+    std::println("times in ms (best of {}), sweep = row operations on the "
+                 "transposed matrix, copy includes transpose_copy",
+                 repetitions);
+    std::println("{:>6} {:>12} {:>12} {:>12} {:>14} {:>14}",
+                 "n",
+                 "naive copy",
+                 "tiled copy",
+                 "in place",
+                 "sweep view",
+                 "sweep copy");
+    for (const std::size_t n : {256, 512, 1024, 2048, 4096}) {
+        benchmark_size(n, generator);
+    }
+    return 0;
+}
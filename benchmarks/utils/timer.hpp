@@ -0,0 +1,95 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+
+namespace benchmarking {
+
+    /*
+        description:
+            runs func repetitions times and returns the fastest run in
+       milliseconds
+    */
+    template <typename Func>
+    inline auto best_of(std::size_t repetitions, Func&& func) -> double {
+        double best{std::numeric_limits<double>::max()};
+        for (std::size_t i = 0; i < repetitions; ++i) {
+            const auto start{std::chrono::steady_clock::now()};
+            func();
+            const auto end{std::chrono::steady_clock::now()};
+            best = std::min(
+                best,
+                std::chrono::duration<double, std::milli>(end - start).count());
+        }
+        return best;
+    }
+
+
+    /*
+        description:
+            summary of the run times of one measured function in milliseconds
+    */
+    struct statistics {
+        std::size_t repetitions{};
+        double minimum{};
+        double median{};
+        double mean{};
+        double standard_deviation{};
+    };
+
+
+    /*
+        description:
+            runs func once to warm caches up, then measures it repetitions
+       times and returns minimum, median, mean and sample standard deviation
+    */
+    template <typename Func>
+    inline auto sample(std::size_t repetitions, Func&& func) -> statistics {
+        func();
+        std::vector<double> times{};
+        times.reserve(repetitions);
+        for (std::size_t i = 0; i < repetitions; ++i) {
+            const auto start{std::chrono::steady_clock::now()};
+            func();
+            const auto end{std::chrono::steady_clock::now()};
+            times.push_back(
+                std::chrono::duration<double, std::milli>(end - start).count());
+        }
+        std::ranges::sort(times);
+        statistics result{.repetitions = repetitions};
+        if (times.empty()) { return result; }
+        const std::size_t middle{times.size() / 2};
+        result.minimum = times.front();
+        result.median = times.size() % 2 == 1
+                            ? times[middle]
+                            : (times[middle - 1] + times[middle]) / 2.0;
+        double sum{0.0};
+        for (const double time : times) { sum += time; }
+        result.mean = sum / static_cast<double>(times.size());
+        if (times.size() > 1) {
+            double squares{0.0};
+            for (const double time : times) {
+                squares += (time - result.mean) * (time - result.mean);
+            }
+            result.standard_deviation =
+                std::sqrt(squares / static_cast<double>(times.size() - 1));
+        }
+        return result;
+    }
+
+
+    /*
+        description:
+            prevents the compiler from optimizing away a computed value
+    */
+    template <typename T>
+    inline auto do_not_optimize(const T& value) -> void {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+}  // namespace benchmarking
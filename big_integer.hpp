@@ -0,0 +1,605 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <format>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "integer_like.hpp"
+namespace number_theory
+{
+    /*arithmetic on magnitudes: little-endian vectors of 64-bit limbs without
+     * zero limbs at the top, so zero has no limbs. Spans passed in may have
+     * zero limbs at the top, results never do*/
+    namespace big_integer_detail {
+        using u128 = unsigned __int128;
+        using limbs = std::vector<std::uint64_t>;
+        using view = std::span<const std::uint64_t>;
+        /*operands shorter than this are multiplied by the schoolbook method*/
+        inline constexpr std::size_t karatsuba_threshold{ 32 };
+        /*divisors and quotients shorter than this are found by Knuth's
+         * algorithm D, longer ones with a Newton reciprocal*/
+        inline constexpr std::size_t newton_threshold{ 512 };
+        /*numbers shorter than this are converted one limb of digits at a time*/
+        inline constexpr std::size_t conversion_threshold{ 64 };
+        /*the bases of to_string and of the parsing constructor*/
+        inline constexpr int smallest_base{ 2 };
+        inline constexpr int largest_base{ 36 };
+        inline constexpr std::string_view digit_symbols{ "0123456789abcdefghijklmnopqrstuvwxyz" };
+
+        inline auto trim(limbs& a) -> void {
+            while (!a.empty() && a.back() == 0) a.pop_back();
+        }
+        inline auto trimmed(view a) -> view {
+            while (!a.empty() && a.back() == 0) a = a.first(a.size() - 1);
+            return a;
+        }
+        inline auto compare(view a, view b) -> std::strong_ordering {
+            a = trimmed(a);
+            b = trimmed(b);
+            if (a.size() != b.size()) return a.size() <=> b.size();
+            for (std::size_t i = a.size(); i-- > 0;) {
+                if (a[i] != b[i]) return a[i] <=> b[i];
+            }
+            return std::strong_ordering::equal;
+        }
+        /*a += b * 2^(64 offset)*/
+        inline auto add_to(limbs& a, view b, std::size_t offset = 0) -> void {
+            b = trimmed(b);
+            if (a.size() < b.size() + offset) a.resize(b.size() + offset, 0);
+            std::uint64_t carry = 0;
+            std::size_t i = offset;
+            for (const std::uint64_t limb : b) {
+                const u128 sum = static_cast<u128>(a[i]) + limb + carry;
+                a[i++] = static_cast<std::uint64_t>(sum);
+                carry = static_cast<std::uint64_t>(sum >> 64);
+            }
+            for (; carry != 0; ++i) {
+                if (i == a.size()) {
+                    a.push_back(carry);
+                    break;
+                }
+                carry = ++a[i] == 0 ? 1 : 0;
+            }
+        }
+        /*a -= b * 2^(64 offset), a must not be smaller than the subtrahend*/
+        inline auto subtract_from(limbs& a, view b, std::size_t offset = 0) -> void {
+            b = trimmed(b);
+            std::uint64_t borrow = 0;
+            std::size_t i = offset;
+            for (const std::uint64_t limb : b) {
+                const u128 difference = static_cast<u128>(a[i]) - limb - borrow;
+                a[i++] = static_cast<std::uint64_t>(difference);
+                borrow = (difference >> 64) != 0 ? 1 : 0;
+            }
+            for (; borrow != 0; ++i) borrow = a[i]-- == 0 ? 1 : 0;
+            trim(a);
+        }
+        /*a = a * factor + addend*/
+        inline auto multiply_add_small(limbs& a, std::uint64_t factor, std::uint64_t addend) -> void {
+            std::uint64_t carry = addend;
+            for (std::uint64_t& limb : a) {
+                const u128 product = static_cast<u128>(limb) * factor + carry;
+                limb = static_cast<std::uint64_t>(product);
+                carry = static_cast<std::uint64_t>(product >> 64);
+            }
+            if (carry != 0) a.push_back(carry);
+            trim(a);
+        }
+        /*a /= divisor, returns the remainder*/
+        inline auto divide_small(limbs& a, std::uint64_t divisor) -> std::uint64_t {
+            u128 remainder = 0;
+            for (std::size_t i = a.size(); i-- > 0;) {
+                const u128 current = (remainder << 64) | a[i];
+                a[i] = static_cast<std::uint64_t>(current / divisor);
+                remainder = current % divisor;
+            }
+            trim(a);
+            return static_cast<std::uint64_t>(remainder);
+        }
+        inline auto shift_left(view a, std::size_t bits) -> limbs {
+            a = trimmed(a);
+            if (a.empty()) return {};
+            const std::size_t words = bits / 64;
+            const std::size_t rest = bits % 64;
+            limbs result(a.size() + words + 1, 0);
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                result[i + words] |= a[i] << rest;
+                if (rest != 0) result[i + words + 1] = a[i] >> (64 - rest);
+            }
+            trim(result);
+            return result;
+        }
+        inline auto shift_right(view a, std::size_t bits) -> limbs {
+            a = trimmed(a);
+            const std::size_t words = bits / 64;
+            const std::size_t rest = bits % 64;
+            if (words >= a.size()) return {};
+            limbs result(a.size() - words);
+            for (std::size_t i = 0; i < result.size(); ++i) {
+                result[i] = a[i + words] >> rest;
+                if (rest != 0 && i + words + 1 < a.size()) result[i] |= a[i + words + 1] << (64 - rest);
+            }
+            trim(result);
+            return result;
+        }
+        /*out += a * b, out must hold a.size() + b.size() limbs*/
+        inline auto multiply_schoolbook(view a, view b, std::span<std::uint64_t> out) -> void {
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                std::uint64_t carry = 0;
+                for (std::size_t j = 0; j < b.size(); ++j) {
+                    const u128 product = static_cast<u128>(a[i]) * b[j] + out[i + j] + carry;
+                    out[i + j] = static_cast<std::uint64_t>(product);
+                    carry = static_cast<std::uint64_t>(product >> 64);
+                }
+                for (std::size_t k = i + b.size(); carry != 0; ++k) {
+                    const u128 sum = static_cast<u128>(out[k]) + carry;
+                    out[k] = static_cast<std::uint64_t>(sum);
+                    carry = static_cast<std::uint64_t>(sum >> 64);
+                }
+            }
+        }
+        inline auto multiply(view a, view b) -> limbs;
+        /*Karatsuba's method for a and b of similar length: with a = a1 B^m + a0
+         * and b = b1 B^m + b0, a b = z2 B^2m + z1 B^m + z0 where z0 = a0 b0,
+         * z2 = a1 b1 and z1 = (a0 + a1)(b0 + b1) - z0 - z2, three products of
+         * half the length instead of four*/
+        inline auto multiply_karatsuba(view a, view b, limbs& out) -> void {
+            const std::size_t m = a.size() / 2;
+            const view a0 = a.first(m);
+            const view a1 = a.subspan(m);
+            const view b0 = b.first(m);
+            const view b1 = b.subspan(m);
+            const limbs z0 = multiply(a0, b0);
+            const limbs z2 = multiply(a1, b1);
+            limbs a_sum(a0.begin(), a0.end());
+            add_to(a_sum, a1);
+            limbs b_sum(b0.begin(), b0.end());
+            add_to(b_sum, b1);
+            limbs z1 = multiply(a_sum, b_sum);
+            subtract_from(z1, z0);
+            subtract_from(z1, z2);
+            add_to(out, z0);
+            add_to(out, z1, m);
+            add_to(out, z2, 2 * m);
+        }
+        /*product of a and b, with Karatsuba's method from karatsuba_threshold
+         * limbs on; a much longer factor is cut into pieces as long as the
+         * shorter one*/
+        inline auto multiply(view a, view b) -> limbs {
+            a = trimmed(a);
+            b = trimmed(b);
+            if (a.size() < b.size()) std::swap(a, b);
+            if (b.empty()) return {};
+            limbs result(a.size() + b.size(), 0);
+            if (b.size() < karatsuba_threshold) {
+                multiply_schoolbook(a, b, result);
+            }
+            else if (a.size() >= 2 * b.size()) {
+                for (std::size_t i = 0; i < a.size(); i += b.size()) {
+                    add_to(result, multiply(a.subspan(i, std::min(b.size(), a.size() - i)), b), i);
+                }
+            }
+            else {
+                multiply_karatsuba(a, b, result);
+            }
+            trim(result);
+            return result;
+        }
+        /*quotient and remainder of a by b of at least two limbs, Knuth's
+         * algorithm D: b is shifted so its top bit is set, then every quotient
+         * limb is estimated from the top limbs and corrected at most twice*/
+        inline auto divide_schoolbook(view a, view b) -> std::pair<limbs, limbs> {
+            const int shift = std::countl_zero(b.back());
+            const limbs v = shift_left(b, shift);
+            limbs u = shift_left(a, shift);
+            u.resize(a.size() + 1, 0);
+            const std::size_t n = v.size();
+            limbs quotient(u.size() - n, 0);
+            for (std::size_t j = quotient.size(); j-- > 0;) {
+                const u128 top = (static_cast<u128>(u[j + n]) << 64) | u[j + n - 1];
+                u128 estimate = top / v[n - 1];
+                u128 rest = top % v[n - 1];
+                while ((estimate >> 64) != 0 || estimate * v[n - 2] > ((rest << 64) | u[j + n - 2])) {
+                    --estimate;
+                    rest += v[n - 1];
+                    if ((rest >> 64) != 0) break;
+                }
+                std::uint64_t carry = 0;
+                std::uint64_t borrow = 0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const u128 product = estimate * v[i] + carry;
+                    carry = static_cast<std::uint64_t>(product >> 64);
+                    const u128 difference = static_cast<u128>(u[i + j]) - static_cast<std::uint64_t>(product) - borrow;
+                    u[i + j] = static_cast<std::uint64_t>(difference);
+                    borrow = (difference >> 64) != 0 ? 1 : 0;
+                }
+                const u128 difference = static_cast<u128>(u[j + n]) - carry - borrow;
+                u[j + n] = static_cast<std::uint64_t>(difference);
+                if ((difference >> 64) != 0) {
+                    --estimate;
+                    std::uint64_t add_carry = 0;
+                    for (std::size_t i = 0; i < n; ++i) {
+                        const u128 sum = static_cast<u128>(u[i + j]) + v[i] + add_carry;
+                        u[i + j] = static_cast<std::uint64_t>(sum);
+                        add_carry = static_cast<std::uint64_t>(sum >> 64);
+                    }
+                    u[j + n] += add_carry;
+                }
+                quotient[j] = static_cast<std::uint64_t>(estimate);
+            }
+            trim(quotient);
+            u.resize(n);
+            return { quotient, shift_right(u, shift) };
+        }
+        /*about floor(B^(2n) / b), at most a few units off, for b of n limbs,
+         * B = 2^64: the reciprocal x of the top half of b is refined by one
+         * Newton step x + x (B^(2n) - b x) / B^(2n), which doubles the number
+         * of correct limbs. x has only zero limbs below the top half, so both
+         * products are taken without them*/
+        inline auto reciprocal(view b) -> limbs {
+            b = trimmed(b);
+            const std::size_t n = b.size();
+            if (n <= newton_threshold) {
+                limbs power(2 * n + 1, 0);
+                power.back() = 1;
+                return divide_schoolbook(power, b).first;
+            }
+            const std::size_t low = n - (n / 2 + 2);
+            const limbs top = reciprocal(b.subspan(low));
+            limbs power(2 * n - low + 1, 0);
+            power.back() = 1;
+            const limbs product = multiply(b, top);
+            const bool above = compare(product, power) > 0;
+            limbs error = above ? product : power;
+            subtract_from(error, above ? power : product);
+            const limbs correction = shift_right(multiply(top, error), 64 * (2 * n - 2 * low));
+            limbs x = shift_left(top, 64 * low);
+            if (above) subtract_from(x, correction);
+            else add_to(x, correction);
+            return x;
+        }
+        /*quotient and remainder of a of at most 2n limbs by b of n limbs, where
+         * x = reciprocal(b): the quotient is estimated from the top n + 1
+         * limbs of a times x and corrected by the few units it is off*/
+        inline auto divide_with_reciprocal(view a, view b, view x) -> std::pair<limbs, limbs> {
+            a = trimmed(a);
+            b = trimmed(b);
+            const std::size_t low = b.size() - 1;
+            const view top = a.size() > low ? a.subspan(low) : view{};
+            limbs quotient = shift_right(multiply(top, x), 64 * (b.size() + 1));
+            limbs product = multiply(quotient, b);
+            const limbs one{ 1 };
+            while (compare(product, a) > 0) {
+                subtract_from(quotient, one);
+                subtract_from(product, b);
+            }
+            limbs remainder(a.begin(), a.end());
+            subtract_from(remainder, product);
+            while (compare(remainder, b) >= 0) {
+                add_to(quotient, one);
+                subtract_from(remainder, b);
+            }
+            return { quotient, remainder };
+        }
+        /*long division in big digits of n limbs, each step divides at most 2n
+         * limbs with the reciprocal of b*/
+        inline auto divide_newton(view a, view b) -> std::pair<limbs, limbs> {
+            const std::size_t n = b.size();
+            const limbs x = reciprocal(b);
+            limbs quotient;
+            limbs remainder;
+            for (std::size_t start = (a.size() - 1) / n * n;; start -= n) {
+                const view digit = a.subspan(start, std::min(n, a.size() - start));
+                limbs current(digit.begin(), digit.end());
+                current.resize(n, 0);
+                add_to(current, remainder, n);
+                auto [q, r] = divide_with_reciprocal(current, b, x);
+                add_to(quotient, q, start);
+                remainder = std::move(r);
+                if (start == 0) break;
+            }
+            trim(quotient);
+            return { quotient, remainder };
+        }
+        /*quotient and remainder of a by b, b must not be zero*/
+        inline auto divide(view a, view b) -> std::pair<limbs, limbs> {
+            a = trimmed(a);
+            b = trimmed(b);
+            if (compare(a, b) < 0) return { {}, limbs(a.begin(), a.end()) };
+            if (b.size() == 1) {
+                limbs quotient(a.begin(), a.end());
+                const std::uint64_t remainder = divide_small(quotient, b[0]);
+                return { quotient, remainder == 0 ? limbs{} : limbs{ remainder } };
+            }
+            if (b.size() < newton_threshold || a.size() - b.size() < newton_threshold) {
+                return divide_schoolbook(a, b);
+            }
+            return divide_newton(a, b);
+        }
+        /*digits of base that fit a limb and base raised to that many*/
+        inline auto digits_per_limb(int base) -> std::pair<std::size_t, std::uint64_t> {
+            std::size_t digits = 0;
+            std::uint64_t power = 1;
+            while (power <= UINT64_MAX / static_cast<std::uint64_t>(base)) {
+                power *= static_cast<std::uint64_t>(base);
+                ++digits;
+            }
+            return { digits, power };
+        }
+        /*powers[k] = chunk^(2^k), where chunk is base raised to digits_per_limb,
+         * with their reciprocals once they are long enough for divide_newton*/
+        struct conversion_powers {
+            std::size_t digits{};
+            std::vector<limbs> powers{};
+            std::vector<limbs> reciprocals{};
+
+            explicit conversion_powers(int base) {
+                const auto [chunk_digits, chunk] = digits_per_limb(base);
+                digits = chunk_digits;
+                powers.push_back({ chunk });
+                reciprocals.emplace_back();
+            }
+            /*makes powers[level] available*/
+            auto extend(std::size_t level) -> void {
+                while (powers.size() <= level) {
+                    powers.push_back(multiply(powers.back(), powers.back()));
+                    reciprocals.push_back(powers.back().size() >= newton_threshold ? reciprocal(powers.back()) : limbs{});
+                }
+            }
+            /*number of digits of powers[level]*/
+            auto width(std::size_t level) const -> std::size_t {
+                return digits << level;
+            }
+            /*quotient and remainder of a < powers[level]^2 by powers[level]*/
+            auto divide(view a, std::size_t level) const -> std::pair<limbs, limbs> {
+                if (reciprocals[level].empty()) return big_integer_detail::divide(a, powers[level]);
+                return divide_with_reciprocal(a, powers[level], reciprocals[level]);
+            }
+        };
+        /*appends the digits of a one limb of digits at a time, at least width
+         * digits padded with zeros, no digits for zero with width 0*/
+        inline auto write_digits_small(limbs a, int base, std::size_t width, std::string& out) -> void {
+            const auto [digits, chunk] = digits_per_limb(base);
+            std::string reversed;
+            while (!a.empty()) {
+                std::uint64_t part = divide_small(a, chunk);
+                for (std::size_t i = 0; i < digits; ++i) {
+                    reversed.push_back(digit_symbols[part % static_cast<std::uint64_t>(base)]);
+                    part /= static_cast<std::uint64_t>(base);
+                }
+            }
+            while (!reversed.empty() && reversed.back() == '0') reversed.pop_back();
+            if (reversed.size() < width) reversed.resize(width, '0');
+            out.append(reversed.rbegin(), reversed.rend());
+        }
+        /*appends the digits of a < powers[level]^2: the quotient by
+         * powers[level] gives the leading digits and the remainder exactly
+         * width(level) more, both converted the same way a level lower*/
+        inline auto write_digits(const limbs& a, std::ptrdiff_t level, std::size_t width, int base,
+            conversion_powers& powers, std::string& out) -> void {
+            if (level < 0 || a.size() <= conversion_threshold) {
+                write_digits_small(a, base, width, out);
+                return;
+            }
+            const auto index = static_cast<std::size_t>(level);
+            if (width == 0 && compare(a, powers.powers[index]) < 0) {
+                write_digits(a, level - 1, 0, base, powers, out);
+                return;
+            }
+            const auto [quotient, remainder] = powers.divide(a, index);
+            const std::size_t low = powers.width(index);
+            write_digits(quotient, level - 1, width > low ? width - low : 0, base, powers, out);
+            write_digits(remainder, level - 1, low, base, powers, out);
+        }
+        /*value of digits in base, the leading part times a power of base plus
+         * the trailing part, so long inputs cost a few Karatsuba products*/
+        inline auto read_digits(std::string_view digits, int base, conversion_powers& powers) -> limbs {
+            if (digits.size() <= conversion_threshold * powers.digits) {
+                limbs result;
+                for (std::size_t start = 0; start < digits.size(); start += powers.digits) {
+                    const std::string_view part = digits.substr(start, powers.digits);
+                    std::uint64_t value = 0;
+                    std::uint64_t scale = 1;
+                    for (const char symbol : part) {
+                        value = value * static_cast<std::uint64_t>(base) + digit_symbols.find(symbol);
+                        scale *= static_cast<std::uint64_t>(base);
+                    }
+                    multiply_add_small(result, scale, value);
+                }
+                return result;
+            }
+            std::size_t level = 0;
+            while (powers.width(level + 1) < digits.size()) ++level;
+            powers.extend(level);
+            const std::size_t split = digits.size() - powers.width(level);
+            limbs result = multiply(read_digits(digits.substr(0, split), base, powers), powers.powers[level]);
+            add_to(result, read_digits(digits.substr(split), base, powers));
+            return result;
+        }
+    }
+    /*signed integer of any size: a sign and a magnitude of 64-bit limbs.
+     * Products use Karatsuba's method, quotients a Newton reciprocal and
+     * conversions from and to strings split the number in halves, so long
+     * numbers cost O(n^1.59 log n) instead of O(n^2). Division truncates
+     * toward zero and the remainder takes the sign of the dividend, like for
+     * the built-in integers, so big_integer can be used wherever a template
+     * takes an integer_like type*/
+    class big_integer {
+    public:
+        big_integer() = default;
+        template <std::integral I>
+        big_integer(I value) {
+            if constexpr (std::is_signed_v<I>) {
+                negative_ = value < 0;
+            }
+            const auto magnitude = negative_ ? std::uint64_t{ 0 } - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+            if (magnitude != 0) magnitude_.push_back(magnitude);
+        }
+        /*parses an optional sign followed by digits in base (2 to 36, letters
+         * in either case), throws std::invalid_argument otherwise*/
+        explicit big_integer(std::string_view text, int base = 10) {
+            check_base(base);
+            const bool sign = !text.empty() && (text.front() == '-' || text.front() == '+');
+            const bool minus = sign && text.front() == '-';
+            if (sign) text.remove_prefix(1);
+            std::string digits(text);
+            for (char& symbol : digits) {
+                if (symbol >= 'A' && symbol <= 'Z') symbol = static_cast<char>(symbol - 'A' + 'a');
+                const std::size_t value = big_integer_detail::digit_symbols.find(symbol);
+                if (value == std::string_view::npos || value >= static_cast<std::size_t>(base)) {
+                    throw std::invalid_argument("Invalid digit.");
+                }
+            }
+            if (digits.empty()) throw std::invalid_argument("No digits.");
+            big_integer_detail::conversion_powers powers{ base };
+            magnitude_ = big_integer_detail::read_digits(digits, base, powers);
+            negative_ = minus && !magnitude_.empty();
+        }
+        /*the value modulo 2^(bits of I), like a conversion between built-in
+         * integers*/
+        template <std::integral I>
+        explicit operator I() const {
+            const std::uint64_t low = magnitude_.empty() ? 0 : magnitude_.front();
+            return static_cast<I>(negative_ ? std::uint64_t{ 0 } - low : low);
+        }
+        explicit operator bool() const { return !magnitude_.empty(); }
+
+        auto is_negative() const -> bool { return negative_; }
+        /*limbs of the absolute value from the least significant one*/
+        auto limbs() const -> std::span<const std::uint64_t> { return magnitude_; }
+        /*number of bits of the absolute value*/
+        auto bit_width() const -> std::size_t {
+            return magnitude_.empty() ? 0 : 64 * magnitude_.size() - std::countl_zero(magnitude_.back());
+        }
+        /*digits in base (2 to 36, lower case letters) with a leading minus
+         * for negative numbers*/
+        auto to_string(int base = 10) const -> std::string {
+            check_base(base);
+            if (magnitude_.empty()) return "0";
+            std::string out = negative_ ? "-" : "";
+            big_integer_detail::conversion_powers powers{ base };
+            std::size_t level = 0;
+            while (2 * powers.powers[level].size() - 1 <= magnitude_.size()) powers.extend(++level);
+            big_integer_detail::write_digits(magnitude_, static_cast<std::ptrdiff_t>(level), 0, base, powers, out);
+            return out;
+        }
+
+        friend auto operator-(big_integer a) -> big_integer {
+            a.negative_ = !a.negative_ && !a.magnitude_.empty();
+            return a;
+        }
+        friend auto operator+(const big_integer& a, const big_integer& b) -> big_integer {
+            if (a.negative_ == b.negative_) {
+                big_integer result = a;
+                big_integer_detail::add_to(result.magnitude_, b.magnitude_);
+                return result;
+            }
+            return subtract_magnitudes(a, b);
+        }
+        friend auto operator-(const big_integer& a, const big_integer& b) -> big_integer {
+            return a + -b;
+        }
+        friend auto operator*(const big_integer& a, const big_integer& b) -> big_integer {
+            big_integer result;
+            result.magnitude_ = big_integer_detail::multiply(a.magnitude_, b.magnitude_);
+            result.negative_ = a.negative_ != b.negative_ && !result.magnitude_.empty();
+            return result;
+        }
+        friend auto operator/(const big_integer& a, const big_integer& b) -> big_integer {
+            return divide(a, b).first;
+        }
+        friend auto operator%(const big_integer& a, const big_integer& b) -> big_integer {
+            return divide(a, b).second;
+        }
+        /*the absolute value shifted, the sign is kept*/
+        friend auto operator<<(const big_integer& a, std::size_t bits) -> big_integer {
+            return with_magnitude(big_integer_detail::shift_left(a.magnitude_, bits), a.negative_);
+        }
+        friend auto operator>>(const big_integer& a, std::size_t bits) -> big_integer {
+            return with_magnitude(big_integer_detail::shift_right(a.magnitude_, bits), a.negative_);
+        }
+        auto operator+=(const big_integer& b) -> big_integer& { return *this = *this + b; }
+        auto operator-=(const big_integer& b) -> big_integer& { return *this = *this - b; }
+        /*a factor of one limb multiplies in place*/
+        auto operator*=(const big_integer& b) -> big_integer& {
+            if (b.magnitude_.size() != 1) return *this = *this * b;
+            big_integer_detail::multiply_add_small(magnitude_, b.magnitude_.front(), 0);
+            negative_ = negative_ != b.negative_ && !magnitude_.empty();
+            return *this;
+        }
+        auto operator/=(const big_integer& b) -> big_integer& { return *this = *this / b; }
+        auto operator%=(const big_integer& b) -> big_integer& { return *this = *this % b; }
+        auto operator<<=(std::size_t bits) -> big_integer& { return *this = *this << bits; }
+        auto operator>>=(std::size_t bits) -> big_integer& { return *this = *this >> bits; }
+        auto operator++() -> big_integer& { return *this += 1; }
+        auto operator--() -> big_integer& { return *this -= 1; }
+
+        friend auto operator==(const big_integer& a, const big_integer& b) -> bool = default;
+        friend auto operator<=>(const big_integer& a, const big_integer& b) -> std::strong_ordering {
+            if (a.negative_ != b.negative_) return b.negative_ <=> a.negative_;
+            const auto order = big_integer_detail::compare(a.magnitude_, b.magnitude_);
+            return a.negative_ ? 0 <=> order : order;
+        }
+        friend auto abs(big_integer a) -> big_integer {
+            a.negative_ = false;
+            return a;
+        }
+        /*greatest common divisor by Euclid's algorithm, never negative*/
+        friend auto gcd(big_integer a, big_integer b) -> big_integer {
+            a.negative_ = false;
+            b.negative_ = false;
+            while (b) a = std::exchange(b, a % b);
+            return a;
+        }
+        friend auto operator<<(std::ostream& out, const big_integer& a) -> std::ostream& {
+            return out << a.to_string();
+        }
+
+    private:
+        static auto check_base(int base) -> void {
+            if (base < big_integer_detail::smallest_base || base > big_integer_detail::largest_base) {
+                throw std::invalid_argument("Base must be between 2 and 36.");
+            }
+        }
+        static auto with_magnitude(big_integer_detail::limbs magnitude, bool negative) -> big_integer {
+            big_integer result;
+            result.magnitude_ = std::move(magnitude);
+            result.negative_ = negative && !result.magnitude_.empty();
+            return result;
+        }
+        /*a + b for a and b of different signs*/
+        static auto subtract_magnitudes(const big_integer& a, const big_integer& b) -> big_integer {
+            const bool a_larger = big_integer_detail::compare(a.magnitude_, b.magnitude_) >= 0;
+            big_integer result = a_larger ? a : b;
+            big_integer_detail::subtract_from(result.magnitude_, a_larger ? b.magnitude_ : a.magnitude_);
+            result.negative_ = result.negative_ && !result.magnitude_.empty();
+            return result;
+        }
+        static auto divide(const big_integer& a, const big_integer& b) -> std::pair<big_integer, big_integer> {
+            if (!b) throw std::invalid_argument("Division by zero.");
+            auto [quotient, remainder] = big_integer_detail::divide(a.magnitude_, b.magnitude_);
+            return { with_magnitude(std::move(quotient), a.negative_ != b.negative_),
+                with_magnitude(std::move(remainder), a.negative_) };
+        }
+
+        big_integer_detail::limbs magnitude_{};
+        bool negative_{ false };
+    };
+}
+/*formats the decimal digits, with the width, fill and alignment options of
+ * strings*/
+template <>
+struct std::formatter<number_theory::big_integer> : std::formatter<std::string> {
+    auto format(const number_theory::big_integer& value, std::format_context& ctx) const {
+        return std::formatter<std::string>::format(value.to_string(), ctx);
+    }
+};
@@ -0,0 +1,356 @@
+// --------------------------------------------------------------
+// Includes and Constants
+// --------------------------------------------------------------
+
+#include <omp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <concurrent_queue.hpp>
+#include <format>
+#include <fstream>
+#include <numeric>
+#include <omp_queue.hpp>
+#include <print>
+#include <queue_test.hpp>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+    constexpr int item_limit = 1000000;   // Items pushed by a measured run
+    constexpr int warmup_limit = 100000;  // Items pushed by a warm-up run
+    constexpr int id_offset = 10000;  // Base offset to differentiate producers
+    constexpr int warmup_runs = 2;    // Discarded runs before measuring
+    constexpr int measured_runs = 10;  // Runs the statistics are taken over
+    constexpr int operations_per_item = 2;  // One push and one pop
+    constexpr double milliseconds_per_second = 1000.0;
+    constexpr double percent = 100.0;
+    constexpr auto csv_path = "queue_benchmark.csv";
+    constexpr auto json_path = "queue_benchmark.json";
+
+    // --------------------------------------------------------------
+    // Internal Helpers (anonymous namespace)
+    // --------------------------------------------------------------
+
+    // One row of the comparison: which queue, which threading and the
+    // statistics measured for a producer/consumer pair
+    struct comparison_row {
+        std::string queue_name;
+        std::string threading;
+        int producers;
+        int consumers;
+        benchmark_result result;
+    };
+
+    // Removes one element without blocking, whichever interface the queue
+    // has: concurrent_queue::pop() blocks, so try_pop() is preferred
+    template <typename QueueType>
+    auto try_pop_from(QueueType& queue) -> bool {
+        if constexpr (requires { queue.try_pop(); }) {
+            return queue.try_pop();
+        } else {
+            return queue.pop();
+        }
+    }
+
+    // Number of items each producer pushes in one run
+    auto items_per_producer(int num_producers, bool warmup) -> int {
+        if (num_producers <= 0) {
+            throw std::invalid_argument("At least one producer is required");
+        }
+        return (warmup ? warmup_limit : item_limit) / num_producers;
+    }
+
+    // Every pushed item has to be popped, the queue must end up empty
+    template <typename QueueType>
+    auto check_drained(const std::string& queue_name, QueueType& queue)
+        -> void {
+        if (!queue.empty()) {
+            throw std::runtime_error(std::format(
+                "[{}] {} items left in the queue", queue_name, queue.size()));
+        }
+    }
+
+    // Producer and consumer counts of the grid: powers of two below the
+    // limit and the limit itself
+    auto grid_axis(int limit) -> std::vector<int> {
+        std::vector<int> axis;
+        for (int count = 1; count < limit; count *= 2) {
+            axis.push_back(count);
+        }
+        axis.push_back(limit);
+        return axis;
+    }
+
+    // Writes the rows as CSV, one line per configuration, the raw times
+    // separated by semicolons in the last column
+    auto write_csv(const std::vector<comparison_row>& rows) -> void {
+        std::ofstream file(csv_path);
+        file << "queue,threading,producers,consumers,mean_time_ms,"
+                "median_time_ms,stddev_ms,cv_percent,throughput_ops_sec,"
+                "raw_times\n";
+        for (const auto& row : rows) {
+            const auto& r = row.result;
+            std::string raw;
+            for (const double time : r.raw_times) {
+                raw += std::format("{}{:.4f}", raw.empty() ? "" : ";", time);
+            }
+            file << std::format(
+                "{},{},{},{},{:.4f},{:.4f},{:.4f},{:.2f},{:.0f},{}\n",
+                row.queue_name,
+                row.threading,
+                row.producers,
+                row.consumers,
+                r.mean_time_ms,
+                r.median_time_ms,
+                r.stddev_ms,
+                r.cv_percent,
+                r.throughput_ops_sec,
+                raw);
+        }
+    }
+
+    // Writes the rows as a JSON array of objects with the same fields
+    auto write_json(const std::vector<comparison_row>& rows) -> void {
+        std::ofstream file(json_path);
+        file << "[\n";
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            const auto& row = rows[i];
+            const auto& r = row.result;
+            std::string raw;
+            for (const double time : r.raw_times) {
+                raw += std::format("{}{:.4f}", raw.empty() ? "" : ", ", time);
+            }
+            file << std::format(
+                "  {{\"queue\": \"{}\", \"threading\": \"{}\", "
+                "\"producers\": {}, \"consumers\": {}, "
+                "\"mean_time_ms\": {:.4f}, \"median_time_ms\": {:.4f}, "
+                "\"stddev_ms\": {:.4f}, \"cv_percent\": {:.2f}, "
+                "\"throughput_ops_sec\": {:.0f}, "
+                "\"raw_times\": [{}]}}{}\n",
+                row.queue_name,
+                row.threading,
+                row.producers,
+                row.consumers,
+                r.mean_time_ms,
+                r.median_time_ms,
+                r.stddev_ms,
+                r.cv_percent,
+                r.throughput_ops_sec,
+                raw,
+                i + 1 < rows.size() ? "," : "");
+        }
+        file << "]\n";
+    }
+
+    // Runs the suite for one queue under both threading models and appends
+    // the rows, printing a line per configuration as it goes
+    template <typename QueueType>
+    auto compare_threading(const std::string& queue_name,
+                           int num_producers,
+                           int num_consumers,
+                           std::vector<comparison_row>& rows) -> void {
+        const auto add_row = [&](const std::string& threading,
+                                 benchmark_result result) {
+            std::print("{:<18} {:<8} {:>3} {:>3} {:>10.3f} {:>10.3f} "
+                       "{:>8.3f} {:>7.2f} {:>14.0f}\n",
+                       queue_name,
+                       threading,
+                       num_producers,
+                       num_consumers,
+                       result.mean_time_ms,
+                       result.median_time_ms,
+                       result.stddev_ms,
+                       result.cv_percent,
+                       result.throughput_ops_sec);
+            rows.push_back({queue_name,
+                            threading,
+                            num_producers,
+                            num_consumers,
+                            std::move(result)});
+        };
+        add_row("jthread",
+                run_benchmark_suite<QueueType>(
+                    queue_name,
+                    num_producers,
+                    num_consumers,
+                    benchmark_stdjthread<QueueType>));
+        add_row("openmp",
+                run_benchmark_suite<QueueType>(queue_name,
+                                               num_producers,
+                                               num_consumers,
+                                               benchmark_openmp<QueueType>));
+    }
+}  // namespace
+
+// --------------------------------------------------------------
+// Benchmark Implementations
+// --------------------------------------------------------------
+
+// Producers push their share of the items, consumers pop until every item
+// has been popped. The queue is created for every run, so runs do not share
+// state.
+template <typename QueueType>
+auto static benchmark_stdjthread(const std::string& queue_name,
+                                 int num_producers,
+                                 int num_consumers,
+                                 bool warmup) -> double {
+    QueueType queue;
+    const int per = items_per_producer(num_producers, warmup);
+    const int total = per * num_producers;
+    std::atomic<int> popped{0};
+    const auto start = std::chrono::high_resolution_clock::now();
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(num_producers + num_consumers);
+        for (int p = 0; p < num_producers; ++p) {
+            threads.emplace_back([&queue, per, p] {
+                for (int i = 0; i < per; ++i) { queue.push(i + p * id_offset); }
+            });
+        }
+        for (int c = 0; c < num_consumers; ++c) {
+            threads.emplace_back([&queue, &popped, total] {
+                while (popped.load(std::memory_order_relaxed) < total) {
+                    if (try_pop_from(queue)) {
+                        popped.fetch_add(1, std::memory_order_relaxed);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+    }  // jthreads join here
+    const auto end = std::chrono::high_resolution_clock::now();
+    check_drained(queue_name, queue);
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Same workload in one OpenMP parallel region. The roles (producers first,
+// then consumers) are dealt out round-robin, so if the runtime grants fewer
+// threads than requested each thread still runs its producers before its
+// consumers and the run cannot deadlock.
+template <typename QueueType>
+auto static benchmark_openmp(const std::string& queue_name,
+                             int num_producers,
+                             int num_consumers,
+                             bool warmup) -> double {
+    QueueType queue;
+    const int per = items_per_producer(num_producers, warmup);
+    const int total = per * num_producers;
+    const int roles = num_producers + num_consumers;
+    int popped = 0;
+    const auto start = std::chrono::high_resolution_clock::now();
+#pragma omp parallel num_threads(roles)
+    {
+#pragma omp for schedule(static, 1) nowait
+        for (int role = 0; role < roles; ++role) {
+            if (role < num_producers) {
+                for (int i = 0; i < per; ++i) {
+                    queue.push(i + role * id_offset);
+                }
+                continue;
+            }
+            while (true) {
+                int current;
+#pragma omp atomic read
+                current = popped;
+                if (current >= total) { break; }
+                if (try_pop_from(queue)) {
+#pragma omp atomic
+                    popped += 1;
+                } else {
+#pragma omp taskyield
+                }
+            }
+        }
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    check_drained(queue_name, queue);
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Discards warmup_runs short runs (thread creation, allocator and OpenMP
+// pool start-up), then measures measured_runs full runs. The standard
+// deviation is the sample one, throughput counts a push and a pop per item
+// over the mean time.
+template <typename QueueType, typename BenchmarkFunc>
+auto static run_benchmark_suite(const std::string& queue_name,
+                                int num_producers,
+                                int num_consumers,
+                                BenchmarkFunc benchmark_function)
+    -> benchmark_result {
+    for (int i = 0; i < warmup_runs; ++i) {
+        benchmark_function(queue_name, num_producers, num_consumers, true);
+    }
+    benchmark_result result{};
+    result.raw_times.reserve(measured_runs);
+    for (int i = 0; i < measured_runs; ++i) {
+        result.raw_times.push_back(benchmark_function(
+            queue_name, num_producers, num_consumers, false));
+    }
+    const auto& times = result.raw_times;
+    const auto count = static_cast<double>(times.size());
+    result.mean_time_ms = std::accumulate(times.begin(), times.end(), 0.0) /
+                          count;
+
+    std::vector<double> sorted = times;
+    std::ranges::sort(sorted);
+    const std::size_t middle = sorted.size() / 2;
+    result.median_time_ms = sorted.size() % 2 == 1
+                                ? sorted[middle]
+                                : (sorted[middle - 1] + sorted[middle]) / 2.0;
+
+    double squares = 0.0;
+    for (const double time : times) {
+        squares += (time - result.mean_time_ms) * (time - result.mean_time_ms);
+    }
+    result.stddev_ms = times.size() > 1 ? std::sqrt(squares / (count - 1.0))
+                                        : 0.0;
+    result.cv_percent = result.stddev_ms / result.mean_time_ms * percent;
+
+    const double operations = static_cast<double>(
+        operations_per_item * (item_limit / num_producers) * num_producers);
+    result.throughput_ops_sec =
+        operations / (result.mean_time_ms / milliseconds_per_second);
+    return result;
+}
+
+// --------------------------------------------------------------
+// Benchmark Interface
+// --------------------------------------------------------------
+
+// Runs both queues under both threading models for every producer and
+// consumer count of the grid, prints a summary line per configuration and
+// writes every statistic to queue_benchmark.csv and queue_benchmark.json.
+auto run_full_comparison(int num_producers, int num_consumers) -> void {
+    std::vector<comparison_row> rows;
+    std::print("\n[queue comparison] {} warm-up and {} measured runs, "
+               "{} items\n",
+               warmup_runs,
+               measured_runs,
+               item_limit);
+    std::print("{:<18} {:<8} {:>3} {:>3} {:>10} {:>10} {:>8} {:>7} {:>14}\n",
+               "queue",
+               "threads",
+               "P",
+               "C",
+               "mean ms",
+               "median ms",
+               "stddev",
+               "cv %",
+               "ops/s");
+    for (const int producers : grid_axis(num_producers)) {
+        for (const int consumers : grid_axis(num_consumers)) {
+            compare_threading<concurrent_queue<int>>(
+                "concurrent_queue", producers, consumers, rows);
+            compare_threading<omp_queue<int>>(
+                "omp_queue", producers, consumers, rows);
+        }
+    }
+    write_csv(rows);
+    write_json(rows);
+    std::print("Results written to {} and {}\n", csv_path, json_path);
+}
@@ -15,7 +15,8 @@ struct benchmark_result {
 };
 
 // Benchmark implementation using std::jthread for concurrency.
-// Returns the average time taken to complete the benchmark in milliseconds.
+// Returns the time taken by one run in milliseconds, a warm-up run pushes a
+// tenth of the items. Throws if items are left in the queue.
 template <typename QueueType>
 auto static benchmark_stdjthread(const std::string& queue_name,
                                  int num_producers,
@@ -23,7 +24,8 @@ auto static benchmark_stdjthread(const std::string& queue_name,
                                  bool warmup = false) -> double;
 
 // Benchmark implementation using OpenMP for concurrency.
-// Returns the average time taken to complete the benchmark in milliseconds.
+// Returns the time taken by one run in milliseconds, a warm-up run pushes a
+// tenth of the items. Throws if items are left in the queue.
 template <typename QueueType>
 auto static benchmark_openmp(const std::string& queue_name,
                              int num_producers,
@@ -31,7 +33,8 @@ auto static benchmark_openmp(const std::string& queue_name,
                              bool warmup = false) -> double;
 
 // Runs a full benchmark suite using the provided benchmark function.
-// Collects detailed statistics and returns them as benchmark_result.
+// Discards warm-up runs, then collects detailed statistics over repeated runs
+// and returns them as benchmark_result.
 template <typename QueueType, typename BenchmarkFunc>
 auto static run_benchmark_suite(const std::string& queue_name,
                                 int num_producers,
@@ -40,5 +43,7 @@ auto static run_benchmark_suite(const std::string& queue_name,
     -> benchmark_result;
 
 // Runs a complete comparison of all queue implementations and benchmark methods
-// using the specified numbers of producers and consumers.
+// over a grid of producer and consumer counts (powers of two up to the
+// specified numbers, and the numbers themselves). Prints a summary and writes
+// every benchmark_result to queue_benchmark.csv and queue_benchmark.json.
 auto run_full_comparison(int num_producers, int num_consumers) -> void;
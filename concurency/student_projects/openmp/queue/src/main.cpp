@@ -2,6 +2,7 @@
 
 #include <benchmark_utils.hpp>
 #include <iostream>
+#include <queue_test.hpp>
 #include <thread>
 #include <transform_dot_benchmark.hpp>
 
@@ -13,6 +14,7 @@ namespace {
     // Runs all benchmark tests and prints the results
     // Benchmark using OpenMP-based queue implementation
     // Benchmark using concurrent_queue with std::jthread
+    // Statistical comparison of both queues under both threading models
     // Runs custom tests defined in own_test module
     auto run_tests() -> void {
         measure_and_print("[omp_queue] OpenMP Benchmark", [] {
@@ -23,6 +25,7 @@ namespace {
             return omp_bench::concurrent_queue_test(k_default_threads,
                                                     k_default_threads);
         });
+        run_full_comparison(k_default_threads, k_default_threads);
         own_bench::run_own_test();
     }
 }  // namespace
@@ -3,10 +3,17 @@
 #include <tuple>
 #include <string>
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
 #include <numeric>
 #include <ranges>
 #include <print>
+#include <span>
 #include <sstream>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace algorithms
@@ -166,6 +173,187 @@ namespace algorithms
 		}
 	};
 
+	// Binary (Stein's) gcd: common factors of two are counted with std::countr_zero,
+	// afterwards both numbers stay odd and the larger one is replaced by the difference,
+	// so there is no division at all
+	template <std::unsigned_integral U>
+	constexpr auto binary_gcd(U a, U b) -> U
+	{
+		if (a == 0 || b == 0)
+		{
+			return a | b;
+		}
+		const int shift = std::countr_zero(a | b);
+		a >>= std::countr_zero(a);
+		b >>= std::countr_zero(b);
+		while (a != b)
+		{
+			const U difference = a > b ? a - b : b - a;
+			a = std::min(a, b);
+			b = difference >> std::countr_zero(difference);
+		}
+		return a << shift;
+	}
+
+	// Lehmer's gcd for 128-bit numbers: the quotients of several Euclidean steps are
+	// found from the leading 62 bits alone, using 64-bit arithmetic, and applied to the
+	// full numbers at once, so a 128-bit division is only needed when a single quotient
+	// is huge. Below 2^64 the binary gcd finishes
+	constexpr auto lehmer_gcd(unsigned __int128 a, unsigned __int128 b) -> unsigned __int128
+	{
+		using u128 = unsigned __int128;
+		if (a < b)
+		{
+			std::swap(a, b);
+		}
+		while ((b >> 64) != 0)
+		{
+			const int shift = 128 - std::countl_zero(static_cast<std::uint64_t>(a >> 64)) - 62;
+			std::int64_t a_hat = static_cast<std::int64_t>(a >> shift);
+			std::int64_t b_hat = static_cast<std::int64_t>(b >> shift);
+			// a = A a0 + B b0, b = C a0 + D b0 for the quotients that are certain
+			std::int64_t A = 1, B = 0, C = 0, D = 1;
+			while (b_hat + C != 0 && b_hat + D != 0)
+			{
+				const std::int64_t q = (a_hat + A) / (b_hat + C);
+				if (q != (a_hat + B) / (b_hat + D))
+				{
+					break;
+				}
+				A = std::exchange(C, A - q * C);
+				B = std::exchange(D, B - q * D);
+				a_hat = std::exchange(b_hat, a_hat - q * b_hat);
+			}
+			if (B == 0)
+			{
+				a = std::exchange(b, a % b);
+				continue;
+			}
+			// the results lie in [0, 2^128), so wrapping arithmetic is exact
+			const u128 new_a = static_cast<u128>(A) * a + static_cast<u128>(B) * b;
+			const u128 new_b = static_cast<u128>(C) * a + static_cast<u128>(D) * b;
+			a = new_a;
+			b = new_b;
+		}
+		if (b == 0)
+		{
+			return a;
+		}
+		const std::uint64_t r = static_cast<std::uint64_t>(a % b);
+		return algorithms::binary_gcd(static_cast<std::uint64_t>(b), r);
+	}
+
+	// Computes results[i] = gcd(as[i], bs[i]) with binary_gcd, whose loop body is
+	// branch-free (min and difference compile to conditional moves). Running blocks of
+	// pairs in lockstep was measured slower: every block waits for its slowest pair
+	template <std::unsigned_integral U>
+	void gcd_batch(std::span<const U> as, std::span<const U> bs, std::span<U> results)
+	{
+		if (as.size() != bs.size() || as.size() != results.size())
+		{
+			throw std::invalid_argument("Spans must have equal lengths.");
+		}
+		for (std::size_t i = 0; i < as.size(); ++i)
+		{
+			results[i] = algorithms::binary_gcd(as[i], bs[i]);
+		}
+	}
+
+	// One pair of gcd_extended_batch, computed in I. The final coefficients always fit
+	// in 64 bits, but -i and the cofactors of the last step reach 2^63 when an input
+	// is INT64_MIN, so those pairs need a wider I
+	template <typename I>
+	inline void gcd_extended_pair(I i, I j, euclidean_result<std::int64_t, std::int64_t>& result)
+	{
+		I x = 0, y = 1, x_prev = 1, y_prev = 0;
+		while (j != 0)
+		{
+			const I quotient = i / j;
+			i = std::exchange(j, i - quotient * j);
+			x_prev = std::exchange(x, x_prev - quotient * x);
+			y_prev = std::exchange(y, y_prev - quotient * y);
+		}
+		if (i < 0)
+		{
+			i = -i;
+			x_prev = -x_prev;
+			y_prev = -y_prev;
+		}
+		result.coefficients = std::tuple{ static_cast<std::int64_t>(x_prev), static_cast<std::int64_t>(y_prev) };
+		result.GCD = static_cast<std::uint64_t>(i);
+	}
+
+	// Computes gcd and Bezout's coefficients for every pair (as[i], bs[i]), with the
+	// division-based extended Euclid on 64-bit numbers and without recording steps.
+	// Pairs with INT64_MIN, where 64-bit negation overflows, run in 128 bits
+	inline void gcd_extended_batch(std::span<const std::int64_t> as, std::span<const std::int64_t> bs,
+		std::span<euclidean_result<std::int64_t, std::int64_t>> results)
+	{
+		if (as.size() != bs.size() || as.size() != results.size())
+		{
+			throw std::invalid_argument("Spans must have equal lengths.");
+		}
+		constexpr std::int64_t minimum = std::numeric_limits<std::int64_t>::min();
+		for (std::size_t k = 0; k < as.size(); ++k)
+		{
+			if (as[k] == minimum || bs[k] == minimum)
+			{
+				gcd_extended_pair<__int128>(as[k], bs[k], results[k]);
+			}
+			else
+			{
+				gcd_extended_pair<std::int64_t>(as[k], bs[k], results[k]);
+			}
+		}
+	}
+
+	// Checks binary_gcd, lehmer_gcd and both batches against std::gcd and Bezout's identity
+	inline bool test_fast_gcd()
+	{
+		std::vector<std::uint64_t> as, bs;
+		for (std::uint64_t k = 0; k < 1000; ++k)
+		{
+			as.push_back(k * k * 7919 % 1000003 * (k % 5 == 0 ? 0 : 1 << (k % 7)));
+			bs.push_back((k + 3) * 104729 % 999983 << (k % 4));
+		}
+		std::vector<std::uint64_t> gcds(as.size());
+		algorithms::gcd_batch<std::uint64_t>(as, bs, gcds);
+		std::vector<std::int64_t> signed_as(as.begin(), as.end()), signed_bs(bs.begin(), bs.end());
+		std::vector<euclidean_result<std::int64_t, std::int64_t>> extended(as.size());
+		algorithms::gcd_extended_batch(signed_as, signed_bs, extended);
+		for (std::size_t k = 0; k < as.size(); ++k)
+		{
+			const std::uint64_t expected = std::gcd(as[k], bs[k]);
+			const auto [x, y] = extended[k].coefficients;
+			if (algorithms::binary_gcd(as[k], bs[k]) != expected || gcds[k] != expected ||
+				extended[k].GCD != expected || x * signed_as[k] + y * signed_bs[k] != static_cast<std::int64_t>(expected))
+			{
+				return false;
+			}
+		}
+		// INT64_MIN has no 64-bit negation, gcd(INT64_MIN, 0) = 2^63
+		constexpr std::int64_t minimum = std::numeric_limits<std::int64_t>::min();
+		const std::vector<std::int64_t> edge_as{ minimum, minimum, minimum, minimum, 6, 0 };
+		const std::vector<std::int64_t> edge_bs{ 0, minimum, -1, 3, minimum, minimum };
+		const std::vector<std::uint64_t> edge_gcds{ 1ULL << 63, 1ULL << 63, 1, 1, 2, 1ULL << 63 };
+		std::vector<euclidean_result<std::int64_t, std::int64_t>> edges(edge_as.size());
+		algorithms::gcd_extended_batch(edge_as, edge_bs, edges);
+		for (std::size_t k = 0; k < edges.size(); ++k)
+		{
+			const auto [x, y] = edges[k].coefficients;
+			if (edges[k].GCD != edge_gcds[k] ||
+				static_cast<__int128>(x) * edge_as[k] + static_cast<__int128>(y) * edge_bs[k] != edge_gcds[k])
+			{
+				return false;
+			}
+		}
+		// (2^64 + 1) (2^61 - 1) and (2^64 + 1) 3^40 share the factor 2^64 + 1, 3^79 and 2 3^40 share 3^40
+		const unsigned __int128 common = (static_cast<unsigned __int128>(1) << 64) + 1;
+		const unsigned __int128 power = 12157665459056928801ULL;
+		return algorithms::lehmer_gcd(common * ((1ULL << 61) - 1), common * power) == common &&
+			algorithms::lehmer_gcd(power * power / 3, power * 2) == power;
+	}
+
 	//Checks gcd(i, j, k) == expected_gcd and checks if Bzout's identity is correct
 	bool test(int i, int j, int k, int64_t expected_gcd)
 	{
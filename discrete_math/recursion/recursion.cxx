@@ -5,11 +5,91 @@ module;
 #include <set>
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <coroutine>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
 
 export module recursion;
 import recursion_helper;
 
 
+/*
+    description:
+        Counts the placements of n queens on a n x n chessboard without
+        storing them. Boards larger than 32 x 32 give 0.
+*/
+export inline auto count_queens(int n) -> std::uint64_t {
+    if (n < 0 || n > 32) { return 0; }
+    if (n <= 1) { return 1; }
+
+    const std::uint32_t all = n == 32 ? ~0U : (1U << n) - 1;
+    const std::vector<n_queens_task> tasks = n_queens_tasks(n);
+    std::vector<std::uint64_t> counts(tasks.size(), 0);
+    for_each_n_queens_task(n, tasks.size(), [&](std::size_t i) {
+        const auto [columns, left, right] = n_queens_task_masks(n, tasks[i]);
+        counts[i] = count_n_queens_bitmask(all, columns, left, right);
+    });
+
+    std::uint64_t count = 0;
+    for (std::uint64_t c : counts) { count += 2 * c; }
+    return count;
+}
+
+
+/*
+    description:
+        Finds the placements of n queens on a n x n chessboard with the
+        bitmask search. Solutions are the columns of the queens row by row,
+        in the order of solve_n_queens_util. Boards larger than 32 x 32 give
+        no solutions.
+*/
+export inline auto queens_solutions(int n) -> std::vector<std::vector<int>> {
+    std::vector<std::vector<int>> solutions;
+    if (n < 0 || n > 32) { return solutions; }
+
+    const std::uint32_t all = n == 32 ? ~0U : (1U << n) - 1;
+    std::vector<int> board(n, -1);
+    if (n <= 1) {
+        solve_n_queens_bitmask(all, 0, 0, 0, 0, board, solutions);
+        return solutions;
+    }
+
+    const std::vector<n_queens_task> tasks = n_queens_tasks(n);
+    std::vector<std::vector<std::vector<int>>> found(tasks.size());
+    for_each_n_queens_task(n, tasks.size(), [&](std::size_t i) {
+        const auto [columns, left, right] = n_queens_task_masks(n, tasks[i]);
+        std::vector<int> task_board(board);
+        task_board[0] = tasks[i].first;
+        task_board[1] = tasks[i].second;
+        solve_n_queens_bitmask(
+            all, 2, columns, left, right, task_board, found[i]);
+    });
+
+    for (std::vector<std::vector<int>>& task_solutions : found) {
+        for (std::vector<int>& solution : task_solutions) {
+            solutions.push_back(solution);
+            for (int& column : solution) { column = n - 1 - column; }
+            solutions.push_back(std::move(solution));
+        }
+    }
+    std::ranges::sort(solutions);
+    return solutions;
+}
+
+
 /*
     description:
         Given n, of a n x n chessboard, finds the proper placement of queens on
@@ -21,11 +101,7 @@ export inline auto queens(int n) -> void {
         return;
     }
 
-    std::vector<std::vector<int>> solutions;
-    std::vector<int> board(n, -1);
-
-    solve_n_queens_util(n, 0, board, solutions);
-    print_solutions(solutions, n);
+    print_solutions(queens_solutions(n), n);
 }
 
 
@@ -251,6 +327,190 @@ export inline auto non_increasing_decompositions(std::size_t number) {
 }
 
 
+/*
+    description:
+        Coroutine behind lazy_subsets, elements has at most 63 numbers so
+        that the 2^size counter fits in 64 bits.
+*/
+inline auto gray_code_subsets(std::vector<std::int32_t> elements)
+    -> generator<std::span<const std::int32_t>> {
+    const std::size_t absent = elements.size();
+    std::vector<std::int32_t> subset;
+    std::vector<std::size_t> element_of_slot;
+    std::vector<std::size_t> slot_of_element(elements.size(), absent);
+    subset.reserve(elements.size());
+    element_of_slot.reserve(elements.size());
+
+    const std::uint64_t count = std::uint64_t{1} << elements.size();
+    for (std::uint64_t k = 1; k < count; ++k) {
+        const std::size_t flipped = std::countr_zero(k);
+        if (slot_of_element[flipped] == absent) {
+            slot_of_element[flipped] = subset.size();
+            subset.push_back(elements[flipped]);
+            element_of_slot.push_back(flipped);
+        } else {
+            const std::size_t slot = slot_of_element[flipped];
+            subset[slot] = subset.back();
+            element_of_slot[slot] = element_of_slot.back();
+            slot_of_element[element_of_slot[slot]] = slot;
+            slot_of_element[flipped] = absent;
+            subset.pop_back();
+            element_of_slot.pop_back();
+        }
+        co_yield std::span<const std::int32_t>{subset};
+    }
+}
+
+
+/*
+    description:
+        Lazy subsets: yields the non-empty subsets of numbers in Gray code
+        order, each subset differs from the previous one by a single number,
+        which is appended or moved out by the last one. The numbers of a
+        subset are in no particular order and the view is valid until the
+        next subset. Sets of up to 63 numbers, larger ones throw
+        std::length_error right away.
+*/
+export inline auto lazy_subsets(std::set<std::int32_t> numbers)
+    -> generator<std::span<const std::int32_t>> {
+    if (numbers.size() >= std::numeric_limits<std::uint64_t>::digits) {
+        throw std::length_error("lazy_subsets: more than 63 numbers");
+    }
+    return gray_code_subsets({numbers.begin(), numbers.end()});
+}
+
+
+/*
+    description:
+        Lazy sequences_from_a_set: yields the same sequences in the same
+        order, the next one is made in place from the previous one, by
+        appending the smallest letter or by replacing the last letter with
+        the next one and dropping the last letters with no next one. The view
+        is valid until the next sequence.
+*/
+export inline auto lazy_sequences_from_a_set(std::set<char> letters,
+                                      std::uint8_t maximal_length)
+    -> generator<std::string_view> {
+    if (letters.empty() || maximal_length == 0) { co_return; }
+
+    const std::vector<char> alphabet(letters.begin(), letters.end());
+    std::vector<std::size_t> indices;
+    std::string sequence;
+    indices.reserve(maximal_length);
+    sequence.reserve(maximal_length);
+    while (true) {
+        if (sequence.size() < maximal_length) {
+            indices.push_back(0);
+            sequence.push_back(alphabet.front());
+        } else {
+            while (!indices.empty() && indices.back() + 1 == alphabet.size()) {
+                indices.pop_back();
+                sequence.pop_back();
+            }
+            if (indices.empty()) { co_return; }
+            sequence.back() = alphabet[++indices.back()];
+        }
+        co_yield std::string_view{sequence};
+    }
+}
+
+
+/*
+    description:
+        Lazy more_ones: yields the same representations in the same order.
+        A one can always be appended, so the next representation turns the
+        last one that may become a zero into a zero and fills the rest with
+        ones. The view is valid until the next representation.
+*/
+export inline auto lazy_more_ones(std::uint8_t number_of_bits)
+    -> generator<std::string_view> {
+    std::string bits(number_of_bits, '1');
+    while (true) {
+        co_yield std::string_view{bits};
+
+        int ones = 0;
+        int zeros = 0;
+        std::size_t last = bits.size();
+        for (std::size_t i = 0; i < bits.size(); ++i) {
+            if (bits[i] == '1' && ones > zeros) { last = i; }
+            (bits[i] == '1' ? ones : zeros)++;
+        }
+        if (last == bits.size()) { co_return; }
+        bits[last] = '0';
+        std::fill(bits.begin() + static_cast<std::ptrdiff_t>(last) + 1,
+                  bits.end(),
+                  '1');
+    }
+}
+
+
+/*
+    description:
+        Lazy increasing_representations: yields the same numbers in the same
+        order. The digits are a combination of number_of_digits out of ten,
+        the next one increases the last digit that can grow and makes the
+        following digits consecutive.
+*/
+export inline auto lazy_increasing_representations(std::uint8_t number_of_digits)
+    -> generator<int> {
+    const int digits_count = 10;
+    if (number_of_digits > digits_count) { co_return; }
+
+    std::vector<int> digits(number_of_digits);
+    std::iota(digits.begin(), digits.end(), 0);
+    while (true) {
+        int number = 0;
+        for (const int digit : digits) { number = number * 10 + digit; }
+        co_yield number;
+
+        std::size_t i = digits.size();
+        while (i > 0 &&
+               digits[i - 1] == digits_count - number_of_digits +
+                                    static_cast<int>(i) - 1) {
+            --i;
+        }
+        if (i == 0) { co_return; }
+        ++digits[i - 1];
+        for (std::size_t j = i; j < digits.size(); ++j) {
+            digits[j] = digits[j - 1] + 1;
+        }
+    }
+}
+
+
+/*
+    description:
+        Lazy non_increasing_decompositions: yields the same decompositions in
+        the same order. The trailing ones of a decomposition are dropped, the
+        last part left is decreased by one and everything that was dropped is
+        appended again as parts as large as that one. The view is valid until
+        the next decomposition.
+*/
+export inline auto lazy_non_increasing_decompositions(std::size_t number)
+    -> generator<std::span<const std::size_t>> {
+    std::vector<std::size_t> parts;
+    parts.reserve(number);
+    if (number > 0) { parts.push_back(number); }
+    while (true) {
+        co_yield std::span<const std::size_t>{parts};
+
+        std::size_t remainder = 0;
+        while (!parts.empty() && parts.back() == 1) {
+            parts.pop_back();
+            ++remainder;
+        }
+        if (parts.empty()) { co_return; }
+        const std::size_t part = --parts.back();
+        ++remainder;
+        while (remainder > part) {
+            parts.push_back(part);
+            remainder -= part;
+        }
+        parts.push_back(remainder);
+    }
+}
+
+
 /*
     description:
         Sorts v using bubble sort and returns sorted vector.
@@ -324,4 +584,165 @@ export inline auto path_in_maze(std::vector<bool> maze,
     maze[startx * columns + starty] = false;
     return found_path;
 }
+
+
+/*
+    description:
+        Given a maze (0 stands for a path, 1 for a wall) of shape rows x columns
+        checks if there is a path from point (startx, starty) to (endx, endy)
+        by breadth-first search. The frontier is a ring_queue of cells and the
+        visited cells are bits of a packed bitset, so the maze is not
+        copied and the stack does not grow with it. As in path_in_maze, the end
+        cell may be a wall.
+*/
+export inline auto path_in_maze_bfs(const std::vector<bool>& maze,
+                                    std::size_t rows,
+                                    std::size_t columns,
+                                    int startx,
+                                    int starty,
+                                    int endx,
+                                    int endy) -> bool {
+    if (startx == endx && starty == endy) { return true; }
+    if (!is_valid_move(maze, rows, columns, startx, starty) || endx < 0 ||
+        endy < 0 || static_cast<std::size_t>(endx) >= rows ||
+        static_cast<std::size_t>(endy) >= columns) {
+        return false;
+    }
+    const std::size_t end = endx * columns + endy;
+    std::vector<std::uint64_t> visited((rows * columns + 63) / 64);
+    ring_queue<std::pair<std::size_t, std::size_t>> frontier{};
+    const auto visit = [&](std::size_t x, std::size_t y) {
+        const std::size_t cell = x * columns + y;
+        visited[cell / 64] |= std::uint64_t{1} << (cell % 64);
+        frontier.push({x, y});
+    };
+    visit(startx, starty);
+    while (!frontier.empty()) {
+        const auto [x, y] = frontier.pop();
+        const std::array<std::pair<std::size_t, std::size_t>, 4> moves{
+            {{x + 1, y}, {x - 1, y}, {x, y + 1}, {x, y - 1}}};
+        for (const auto& [next_x, next_y] : moves) {
+            if (next_x >= rows || next_y >= columns) { continue; }
+            const std::size_t next = next_x * columns + next_y;
+            if (next == end) { return true; }
+            if (maze[next] ||
+                (visited[next / 64] >> (next % 64) & 1) != 0) {
+                continue;
+            }
+            visit(next_x, next_y);
+        }
+    }
+    return false;
+}
+
+
+/*
+    description:
+        Finds a shortest path from point (startx, starty) to (endx, endy) in a
+        maze (0 stands for a path, 1 for a wall) of shape rows x columns and
+        returns its cells as (row, column) pairs from the start to the end, or
+        an empty vector when there is none. The search is a breadth-first search
+        on a packed_maze that advances whole words of the frontier at once with
+        shifts, each word of the frontier spreading into itself and the four
+        words around it. The distance of
+        every visited cell modulo 3 is kept in two more bitsets, which is enough
+        to walk back from the end, as the distances of neighbours differ by at
+        most 1. As in path_in_maze, the end cell may be a wall.
+*/
+export inline auto shortest_path_in_maze(const std::vector<bool>& maze,
+                                         std::size_t rows,
+                                         std::size_t columns,
+                                         int startx,
+                                         int starty,
+                                         int endx,
+                                         int endy)
+    -> std::vector<std::pair<std::size_t, std::size_t>> {
+    if (!is_valid_move(maze, rows, columns, startx, starty) || endx < 0 ||
+        endy < 0 || static_cast<std::size_t>(endx) >= rows ||
+        static_cast<std::size_t>(endy) >= columns) {
+        if (startx == endx && starty == endy) {
+            return {{static_cast<std::size_t>(startx),
+                     static_cast<std::size_t>(starty)}};
+        }
+        return {};
+    }
+    packed_maze packed = pack_maze(maze, rows, columns);
+    const std::size_t width = packed.words_per_row;
+    const std::size_t words = packed.open.size();
+    const auto word_of = [&](std::size_t x, std::size_t y) {
+        return x * width + y / 64;
+    };
+    const auto bit_of = [](std::size_t y) { return std::uint64_t{1} << (y % 64); };
+    const std::size_t end_word = word_of(endx, endy);
+    const std::uint64_t end_bit = bit_of(endy);
+    packed.open[end_word] |= end_bit;
+
+    std::vector<std::uint64_t> frontier(words);
+    std::vector<std::uint64_t> next(words);
+    std::vector<std::uint64_t> visited(words);
+    std::array<std::vector<std::uint64_t>, 2> distance_mod_3{
+        std::vector<std::uint64_t>(words), std::vector<std::uint64_t>(words)};
+    std::vector<std::size_t> active{word_of(startx, starty)};
+    std::vector<std::size_t> next_active{};
+    frontier[active.front()] = bit_of(starty);
+    visited[active.front()] = bit_of(starty);
+    std::size_t distance = 0;
+    while (!active.empty() && (visited[end_word] & end_bit) == 0) {
+        ++distance;
+        next_active.clear();
+        const auto reach = [&](std::size_t word, std::uint64_t bits) {
+            bits &= packed.open[word] & ~visited[word];
+            if (bits == 0) { return; }
+            if (next[word] == 0) { next_active.push_back(word); }
+            next[word] |= bits;
+        };
+        for (const std::size_t word : active) {
+            const std::uint64_t bits = std::exchange(frontier[word], 0);
+            const std::size_t column = word % width;
+            reach(word, (bits << 1) | (bits >> 1));
+            if (column > 0 && (bits & 1) != 0) {
+                reach(word - 1, std::uint64_t{1} << 63);
+            }
+            if (column + 1 < width && (bits >> 63) != 0) { reach(word + 1, 1); }
+            if (word >= width) { reach(word - width, bits); }
+            if (word + width < words) { reach(word + width, bits); }
+        }
+        for (const std::size_t word : next_active) {
+            visited[word] |= next[word];
+            if (distance % 3 != 0) {
+                distance_mod_3[distance % 3 - 1][word] |= next[word];
+            }
+        }
+        std::swap(frontier, next);
+        std::swap(active, next_active);
+    }
+    if ((visited[end_word] & end_bit) == 0) { return {}; }
+
+    const auto distance_class = [&](std::size_t x, std::size_t y) -> std::size_t {
+        const std::size_t word = word_of(x, y);
+        const std::uint64_t bit = bit_of(y);
+        if ((visited[word] & bit) == 0) { return 3; }
+        if ((distance_mod_3[0][word] & bit) != 0) { return 1; }
+        if ((distance_mod_3[1][word] & bit) != 0) { return 2; }
+        return 0;
+    };
+    std::vector<std::pair<std::size_t, std::size_t>> path(distance + 1);
+    std::size_t x = endx;
+    std::size_t y = endy;
+    for (std::size_t step = distance; step > 0; --step) {
+        path[step] = {x, y};
+        const std::array<std::pair<std::size_t, std::size_t>, 4> moves{
+            {{x + 1, y}, {x - 1, y}, {x, y + 1}, {x, y - 1}}};
+        for (const auto& [previous_x, previous_y] : moves) {
+            if (previous_x < rows && previous_y < columns &&
+                distance_class(previous_x, previous_y) == (step - 1) % 3) {
+                x = previous_x;
+                y = previous_y;
+                break;
+            }
+        }
+    }
+    path.front() = {x, y};
+    return path;
+}
 // NOLINTEND
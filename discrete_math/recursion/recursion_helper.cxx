@@ -5,6 +5,20 @@ module;
 #include <set>
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <coroutine>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <string_view>
+#include <utility>
 
 export module recursion_helper;
 
@@ -49,6 +63,152 @@ export inline void solve_n_queens_util(
 }
 
 
+/*
+    description:
+        Helper recursive function for count_queens. Bits of columns, left and
+        right are the squares of the current row attacked along a column and
+        along both diagonals, the free squares are taken lowest set bit first.
+*/
+export inline auto count_n_queens_bitmask(std::uint32_t all,
+                                   std::uint32_t columns,
+                                   std::uint32_t left,
+                                   std::uint32_t right) -> std::uint64_t {
+    if (columns == all) { return 1; }
+
+    std::uint64_t count = 0;
+    std::uint32_t free = all & ~(columns | left | right);
+    while (free != 0) {
+        const std::uint32_t bit = free & (~free + 1);
+        free ^= bit;
+        count += count_n_queens_bitmask(all,
+                                        columns | bit,
+                                        ((left | bit) << 1) & all,
+                                        (right | bit) >> 1);
+    }
+    return count;
+}
+
+
+/*
+    description:
+        Helper recursive function for queens_solutions, the bitmask search of
+        count_n_queens_bitmask that stores the column of every row in board
+*/
+export inline void solve_n_queens_bitmask(std::uint32_t all,
+                                   std::size_t row,
+                                   std::uint32_t columns,
+                                   std::uint32_t left,
+                                   std::uint32_t right,
+                                   std::vector<int>& board,
+                                   std::vector<std::vector<int>>& solutions) {
+    if (columns == all) {
+        solutions.push_back(board);
+        return;
+    }
+
+    std::uint32_t free = all & ~(columns | left | right);
+    while (free != 0) {
+        const std::uint32_t bit = free & (~free + 1);
+        free ^= bit;
+        board[row] = std::countr_zero(bit);
+        solve_n_queens_bitmask(all,
+                               row + 1,
+                               columns | bit,
+                               ((left | bit) << 1) & all,
+                               (right | bit) >> 1,
+                               board,
+                               solutions);
+    }
+}
+
+
+/*
+    description:
+        Columns of the queens in the first two rows of one subtree of the
+        N-Queens search.
+*/
+export struct n_queens_task {
+    int first;
+    int second;
+};
+
+
+/*
+    description:
+        Splits the N-Queens search on the first two rows. The mirror image of
+        a solution is a solution too, so only the first queens in the left half
+        of the row are taken, and for odd n with the first queen in the middle
+        column only the second queens in the left half. Every task stands for
+        itself and its mirror image.
+*/
+export inline auto n_queens_tasks(int n) -> std::vector<n_queens_task> {
+    std::vector<n_queens_task> tasks;
+    const int half = n / 2;
+    for (int first = 0; first < half + n % 2; first++) {
+        const int last = first < half ? n : half;
+        for (int second = 0; second < last; second++) {
+            if (std::abs(second - first) > 1) {
+                tasks.push_back({first, second});
+            }
+        }
+    }
+    return tasks;
+}
+
+
+/*
+    description:
+        Masks of the third row after placing the queens of a task.
+*/
+export inline auto n_queens_task_masks(int n, n_queens_task task)
+    -> std::array<std::uint32_t, 3> {
+    const std::uint32_t all = n == 32 ? ~0U : (1U << n) - 1;
+    const std::uint32_t first = 1U << task.first;
+    const std::uint32_t second = 1U << task.second;
+    return {first | second,
+            ((first << 2) | (second << 1)) & all,
+            (first >> 2) | (second >> 1)};
+}
+
+
+/*
+    description:
+        Smallest board searched by more than one thread, smaller boards take
+        less time than starting the threads.
+*/
+export inline constexpr int n_queens_parallel_size = 10;
+
+
+/*
+    description:
+        Runs task(i) for every i below count. Large boards are shared between
+        the hardware threads, each thread takes the next task as soon as it
+        is done with the last one, so threads with short subtrees are not left
+        idle.
+*/
+export template <typename Task>
+inline auto for_each_n_queens_task(int n, std::size_t count, Task&& task)
+    -> void {
+    if (n < n_queens_parallel_size) {
+        for (std::size_t i = 0; i < count; i++) { task(i); }
+        return;
+    }
+
+    std::atomic<std::size_t> next{0};
+    const std::size_t threads = std::min<std::size_t>(
+        count, std::max(1U, std::thread::hardware_concurrency()));
+    std::vector<std::jthread> workers;
+    workers.reserve(threads);
+    for (std::size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&] {
+            for (std::size_t i = next++; i < count; i = next++) { task(i); }
+        });
+    }
+}
+
+
+
+
 /*
     description:
         Helper function for print_solutions
@@ -387,6 +547,82 @@ export inline auto is_valid_move(const std::vector<bool>& maze,
 }
 
 
+/*
+    description:
+        First in, first out queue on a ring buffer whose capacity is a power of
+        two. It doubles when full, so queued elements are only moved when it
+        grows.
+*/
+export template <typename T>
+class ring_queue {
+  public:
+    auto empty() const -> bool { return count == 0; }
+    auto size() const -> std::size_t { return count; }
+    auto push(T value) -> void {
+        if (count == buffer.size()) { grow(); }
+        buffer[(head + count) & (buffer.size() - 1)] = std::move(value);
+        ++count;
+    }
+    auto pop() -> T {
+        T value = std::move(buffer[head]);
+        head = (head + 1) & (buffer.size() - 1);
+        --count;
+        return value;
+    }
+
+  private:
+    auto grow() -> void {
+        std::vector<T> larger(std::max<std::size_t>(2 * buffer.size(), 64));
+        for (std::size_t i = 0; i < count; ++i) {
+            larger[i] = std::move(buffer[(head + i) & (buffer.size() - 1)]);
+        }
+        buffer = std::move(larger);
+        head = 0;
+    }
+
+    std::vector<T> buffer{};
+    std::size_t head{0};
+    std::size_t count{0};
+};
+
+
+/*
+    description:
+        A maze packed into rows of 64-bit words: bit y % 64 of word
+        x * words_per_row + y / 64 is set when the cell (x, y) is open. The bits
+        past the last column stay clear, so shifts do not leak between rows.
+*/
+export struct packed_maze {
+    std::size_t rows{};
+    std::size_t columns{};
+    std::size_t words_per_row{};
+    std::vector<std::uint64_t> open{};
+};
+
+
+/*
+    description:
+        Packs a maze (0 stands for a path, 1 for a wall) of shape rows x columns.
+*/
+export inline auto pack_maze(const std::vector<bool>& maze,
+                             std::size_t rows,
+                             std::size_t columns) -> packed_maze {
+    packed_maze packed{rows, columns, (columns + 63) / 64, {}};
+    packed.open.resize(rows * packed.words_per_row);
+    for (std::size_t x = 0; x < rows; ++x) {
+        for (std::size_t y = 0; y < columns; y += 64) {
+            std::uint64_t word = 0;
+            for (std::size_t bit = 0; bit < 64 && y + bit < columns; ++bit) {
+                word |= std::uint64_t{!maze[x * columns + y + bit]} << bit;
+            }
+            packed.open[x * packed.words_per_row + y / 64] = word;
+        }
+    }
+    return packed;
+}
+
+
+
 export inline auto find_sequences(const std::vector<int>& v0,
                                   const std::vector<int>& v1,
                                   int indexi,
@@ -419,4 +655,89 @@ export inline auto find_sequences(const std::vector<int>& v0,
 
     return sequences;
 }
+
+
+/*
+    description:
+        Lazy sequence produced by a coroutine, a minimal std::generator which
+        is not in libc++ yet. Every value is yielded by reference and is valid
+        until the iterator is incremented, so a coroutine can yield a view of
+        a buffer it keeps reusing.
+*/
+export template <typename T>
+class generator {
+  public:
+    struct promise_type {
+        const T* current{nullptr};
+
+        auto get_return_object() -> generator {
+            return generator{
+                std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        auto initial_suspend() noexcept -> std::suspend_always { return {}; }
+        auto final_suspend() noexcept -> std::suspend_always { return {}; }
+        auto yield_value(const T& value) noexcept -> std::suspend_always {
+            current = std::addressof(value);
+            return {};
+        }
+        auto return_void() noexcept -> void {}
+        auto unhandled_exception() -> void { throw; }
+    };
+
+
+    class iterator {
+      public:
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        explicit iterator(std::coroutine_handle<promise_type> coroutine)
+            : coroutine{coroutine} {}
+
+        auto operator*() const -> const T& {
+            return *coroutine.promise().current;
+        }
+        auto operator++() -> iterator& {
+            coroutine.resume();
+            return *this;
+        }
+        auto operator++(int) -> void { ++*this; }
+        auto operator==(std::default_sentinel_t) const -> bool {
+            return !coroutine || coroutine.done();
+        }
+
+      private:
+        std::coroutine_handle<promise_type> coroutine{};
+    };
+
+
+    generator(const generator&) = delete;
+    generator(generator&& other) noexcept
+        : coroutine{std::exchange(other.coroutine, {})} {}
+    auto operator=(const generator&) -> generator& = delete;
+    auto operator=(generator&& other) noexcept -> generator& {
+        std::swap(coroutine, other.coroutine);
+        return *this;
+    }
+    ~generator() {
+        if (coroutine) { coroutine.destroy(); }
+    }
+
+    /*
+        description:
+            Runs the coroutine to its first value, a generator can be
+            iterated once.
+    */
+    auto begin() -> iterator {
+        coroutine.resume();
+        return iterator{coroutine};
+    }
+    auto end() -> std::default_sentinel_t { return {}; }
+
+  private:
+    explicit generator(std::coroutine_handle<promise_type> coroutine)
+        : coroutine{coroutine} {}
+
+    std::coroutine_handle<promise_type> coroutine;
+};
 // NOLINTEND
@@ -10,9 +10,16 @@
 #include <vector>
 #include <string>
 #include <print>
+#include <cstdint>
+#include <utility>
+#include "../../integer_like.hpp"
+#include "../../big_integer.hpp"
 
 namespace representation {
 
+	// the built-in integers and number_theory::big_integer
+	using number_theory::integer_like;
+
 	/*
 		description:
 			defines the fraction structure to represent
@@ -23,7 +30,7 @@ namespace representation {
 		methods:
 			operator-= - subtracts an integer value from the fraction
 	*/
-	template <std::integral I>
+	template <integer_like I>
 	struct fraction {
 		I numerator{ 0 };
 		I denominator{ 1 };
@@ -37,7 +44,8 @@ namespace representation {
 			reduce fraction
 	*/
 		void reduce() {
-			I divider = std::gcd(numerator, denominator);
+			using std::gcd;
+			I divider = gcd(numerator, denominator);
 			numerator /= divider;
 			denominator /= divider;
 		}
@@ -51,7 +59,7 @@ namespace representation {
 			overloads the addition operator for fractions,
 			allowing addition of fractions
 	*/
-	template <std::integral I>
+	template <integer_like I>
 	constexpr fraction<I> operator+(fraction<I> f, fraction<I> g) {
 		fraction<I> result{};
 		result.numerator =
@@ -68,7 +76,7 @@ namespace representation {
 			enables formatting of output data
 			for representation::fraction<I>
 	*/
-template <std::integral I>
+template <representation::integer_like I>
 struct std::formatter<representation::fraction<I>> {
 
 	template <typename FormatParseContext>
@@ -129,73 +137,282 @@ namespace representation {
 
 	/*
 		description:
-			expands the whole part of a fraction in the specified base
+			symbol of a digit: 0-9, then small letters,
+			as std::to_chars writes the whole part,
+			or capital ones, as in the fractional part
+	*/
+	inline auto digit_symbol(std::uint64_t digit, bool capital) -> char {
+		const char letters = capital ? 'A' : 'a';
+		return digit < 10 ? static_cast<char>('0' + digit)
+			: static_cast<char>(letters + (digit - 10));
+	}
+
+	/*
+		description:
+			the largest level whose values, below base^(2^(level + 1)),
+			fit std::uint64_t and are converted one digit at a time
 	*/
 	template <std::uint8_t base>
-	inline auto expand_whole(std::integral auto i) -> expansion<base> {
-		expansion<base> expan{};
+	inline constexpr std::size_t leaf_level = [] {
+		std::size_t level{ 0 };
+		std::uint64_t power{ base };
+		while (power <= UINT32_MAX) {
+			power *= power;
+			++level;
+		}
+		return level - 1;
+	}();
+
+	/*
+		description:
+			defines the powers of base used by
+			the divide and conquer conversions
+		members:
+			std::vector<I> powers - powers[k] = base^(2^k)
+		methods:
+			extend - squares the last power until value < powers.back()^2
+			power - base^exponent as a product of the powers
+	*/
+	template <std::uint8_t base, integer_like I>
+	struct base_powers {
+		std::vector<I> powers{ I{ base } };
 
-		const std::size_t max_integer_string_length{ 129 };
-		auto& whole = expan.whole;
-		whole.resize(max_integer_string_length);
-		auto result =
-			std::to_chars(whole.data(), whole.data()
-				+ whole.size(), i, base);
+		void extend(const I& value) {
+			while (powers.back() <= value / powers.back())
+				powers.push_back(powers.back() * powers.back());
+		}
 
-		const std::size_t used_bytes{ static_cast<std::size_t>(result.ptr
-			- whole.data()) };
-		whole.resize(used_bytes);
+		auto power(std::size_t exponent) -> I {
+			I result{ 1 };
+			for (std::size_t k = 0; exponent != 0; ++k, exponent >>= 1) {
+				if (k == powers.size())
+					powers.push_back(powers.back() * powers.back());
+				if ((exponent & 1) != 0)
+					result *= powers[k];
+			}
+			return result;
+		}
+	};
 
-		expan.whole = whole;
+	/*
+		description:
+			appends the digits of value < powers[level]^2 padded
+			with zeros to width: the quotient by powers[level] gives
+			the leading digits and the remainder 2^level more,
+			both written a level lower
+	*/
+	template <std::uint8_t base, integer_like I>
+	inline auto write_digits(const I& value, std::size_t level,
+		std::size_t width, bool capital,
+		const base_powers<base, I>& powers, std::string& out) -> void {
+		if (level <= leaf_level<base>) {
+			auto part = static_cast<std::uint64_t>(value);
+			std::string reversed{};
+			for (; part != 0; part /= base)
+				reversed.push_back(digit_symbol(part % base, capital));
+			if (reversed.size() < width)
+				reversed.resize(width, '0');
+			out.append(reversed.rbegin(), reversed.rend());
+			return;
+		}
+		const I& divisor = powers.powers[level];
+		if (value < divisor) {
+			write_digits(value, level - 1, width, capital, powers, out);
+			return;
+		}
+		const I quotient = value / divisor;
+		const I remainder = value - quotient * divisor;
+		const std::size_t low{ std::size_t{ 1 } << level };
+		write_digits(quotient, level - 1, width > low ? width - low : 0,
+			capital, powers, out);
+		write_digits(remainder, level - 1, low, capital, powers, out);
+	}
+
+	/*
+		description:
+			digits of a non-negative value in base padded with zeros
+			to width, in O(M(n) log n) for numbers of n digits
+			whose products cost M(n)
+	*/
+	template <std::uint8_t base, integer_like I>
+	inline auto to_digits(const I& value, std::size_t width, bool capital,
+		base_powers<base, I>& powers) -> std::string {
+		powers.extend(value);
+		std::string digits{};
+		write_digits(value, powers.powers.size() - 1, width, capital,
+			powers, digits);
+		return digits;
+	}
+
+	/*
+		description:
+			expands the whole part of a fraction in the specified base,
+			built-in integers with std::to_chars, longer ones
+			by divide and conquer
+	*/
+	template <std::uint8_t base>
+	inline auto expand_whole(integer_like auto i) -> expansion<base> {
+		using I = decltype(i);
+		expansion<base> expan{};
+
+		if constexpr (std::integral<I>) {
+			const std::size_t max_integer_string_length{ 129 };
+			auto& whole = expan.whole;
+			whole.resize(max_integer_string_length);
+			auto result =
+				std::to_chars(whole.data(), whole.data()
+					+ whole.size(), i, base);
+
+			const std::size_t used_bytes{ static_cast<std::size_t>(result.ptr
+				- whole.data()) };
+			whole.resize(used_bytes);
+		}
+		else {
+			base_powers<base, I> powers{};
+			if (i < I{ 0 }) {
+				expan.whole = "-";
+				i = -i;
+			}
+			expan.whole += to_digits(i, 1, false, powers);
+		}
 		return expan;
 	}
 
 	/*
 		description:
-			expands the repeating part of a fraction in the specified base
+			the next length digits of remainder / denominator
+			in base and the remainder after them, built-in integers
+			one digit at a time, longer ones by one division of
+			remainder * base^length written by divide and conquer
 	*/
-	template <std::uint8_t base, std::integral I>
+	template <std::uint8_t base, integer_like I>
+	inline auto fractional_digits(I remainder, const I& denominator,
+		std::size_t length) -> std::pair<std::string, I> {
+		std::string digits{};
+		if constexpr (std::integral<I>) {
+			digits.reserve(length);
+			for (std::size_t i = 0; i < length; ++i) {
+				remainder *= base;
+				digits.push_back(digit_symbol(
+					static_cast<std::uint64_t>(remainder / denominator), true));
+				remainder %= denominator;
+			}
+		}
+		else if (length != 0) {
+			base_powers<base, I> powers{};
+			const I shifted = remainder * powers.power(length);
+			const I quotient = shifted / denominator;
+			remainder = shifted - quotient * denominator;
+			digits = to_digits(quotient, length, true, powers);
+		}
+		return { digits, remainder };
+	}
+
+	/*
+		description:
+			divides the prime p out of value and returns its exponent,
+			by p^(2^k) from the largest power dividing value down,
+			so a long run of factors costs a few divisions
+	*/
+	template <integer_like I>
+	inline auto strip_prime(I& value, const I& p) -> std::size_t {
+		std::vector<I> powers{ p };
+		while (powers.back() <= value / powers.back()
+			&& value % (powers.back() * powers.back()) == I{ 0 })
+			powers.push_back(powers.back() * powers.back());
+		std::size_t exponent{ 0 };
+		for (std::size_t k = powers.size(); k-- > 0;) {
+			if (value % powers[k] == I{ 0 }) {
+				value /= powers[k];
+				exponent += std::size_t{ 1 } << k;
+			}
+		}
+		return exponent;
+	}
+
+	/*
+		description:
+			number of digits before the period of a fraction
+			with the reduced denominator: the largest
+			ceil(v_p(denominator) / v_p(base)) over the primes p of base,
+			which are divided out of denominator
+	*/
+	template <std::uint8_t base, integer_like I>
+	inline auto strip_base_primes(I& denominator) -> std::size_t {
+		std::size_t digits{ 0 };
+		std::uint32_t rest{ base };
+		for (std::uint32_t p = 2; p <= rest; ++p) {
+			std::size_t in_base{ 0 };
+			for (; rest % p == 0; rest /= p)
+				++in_base;
+			if (in_base == 0)
+				continue;
+			const std::size_t in_denominator{
+				strip_prime(denominator, I{ static_cast<int>(p) }) };
+			digits = std::max(digits,
+				(in_denominator + in_base - 1) / in_base);
+		}
+		return digits;
+	}
+
+	/*
+		description:
+			multiplicative order of base modulo a modulus coprime
+			to it and greater than 1: after the digits before the period
+			the remainders form a pure cycle, so it is closed by stepping
+			base^k until it returns to 1 in constant memory
+			instead of searching the list of seen remainders
+	*/
+	template <std::uint8_t base, integer_like I>
+	inline auto multiplicative_order(const I& modulus) -> std::size_t {
+		const I one{ 1 };
+		const I step{ base };
+		I power = step % modulus;
+		std::size_t order{ 1 };
+		for (; power != one; ++order)
+			power = power * step % modulus;
+		return order;
+	}
+
+	/*
+		description:
+			expands the repeating part of a fraction in the specified base,
+			length digits from remainder, the one after the digits
+			before the period
+	*/
+	template <std::uint8_t base, integer_like I>
 	inline auto expand_period_part(expansion<base>& expan, fraction<I> frac,
-		I remainder, std::vector<I> rs, std::string result)
+		I remainder, std::size_t length)
 		-> void {
-		int index = std::ranges::distance(rs.begin(), 
-			std::ranges::find(rs, remainder));
-		expan.period = result.substr(index, result.size() - index);
-		expan.fractial = result.substr(0, index);
+		expan.period = fractional_digits<base>(
+			remainder, frac.denominator, length).first;
 	}
 
 	/*
 		 description:
-			 expands the fractional part of a fraction in the specified base
+			 expands the fractional part of a fraction in the specified base:
+			 the digits before the period are counted from the primes
+			 the reduced denominator shares with base and the period
+			 is the multiplicative order of base modulo the rest of it
 	*/
-	template <std::uint8_t base, std::integral I>
+	template <std::uint8_t base, integer_like I>
 	inline auto expand_fractional_part(expansion<base>& expan,
 		fraction<I> frac)
 		-> void {
-		const int ascii_table_chars_start = 55;
-		std::string result = "";
-		I remainder = frac.numerator % frac.denominator;
-		auto num = frac.numerator;
-		auto den = frac.denominator;
-		std::vector<I> rs;
-		while (remainder != 0 && std::find(rs.begin(), rs.end(), remainder) 
-			== rs.end()) {
-			rs.push_back(remainder);
-			frac.numerator = remainder * base;
-			if (frac.numerator / frac.denominator < 10)
-				result += std::to_string(frac.numerator / frac.denominator);
-			else
-				result += static_cast<char>(frac.numerator / frac.denominator
-					+ ascii_table_chars_start);
-			remainder = frac.numerator % frac.denominator;
-		}
-
-		if (remainder != 0)
-			expand_period_part(expan, frac, remainder, rs, result);
-		else {
-			expan.fractial = result;
-			expan.period = "";
-		}
+		frac.numerator %= frac.denominator;
+		if (frac.numerator < I{ 0 })
+			frac.numerator = -frac.numerator;
+		frac.reduce();
+		I coprime_part = frac.denominator;
+		const std::size_t before_period{
+			strip_base_primes<base>(coprime_part) };
+		auto [fractial, remainder] = fractional_digits<base>(
+			frac.numerator, frac.denominator, before_period);
+		expan.fractial = std::move(fractial);
+		expan.period = "";
+		if (remainder != I{ 0 })
+			expand_period_part(expan, frac, remainder,
+				multiplicative_order<base>(coprime_part));
 	}
 
 	/*
@@ -205,7 +422,7 @@ namespace representation {
 			to expand a fraction into its whole, fractional, 
 			and repeating parts
 	*/
-	template <std::uint8_t base, std::integral I>
+	template <std::uint8_t base, integer_like I>
 	inline auto expand(fraction<I> frac) -> expansion<base> {
 		expansion<base> expan{};
 		auto whole = frac.numerator / frac.denominator;
@@ -362,6 +579,20 @@ void representation_test(std::string whole, std::string fractial,
 	print_tests(original_expansion, expected_fraction, fraction_result);
 }
 
+template <std::uint8_t base>
+void representation_test(number_theory::big_integer numerator,
+	number_theory::big_integer denominator,
+	std::string whole, std::string fractial, std::string period) {
+	representation::fraction<number_theory::big_integer> original_fraction{
+		numerator, denominator };
+	representation::expansion<base> expected_expansion{
+		whole, fractial, period };
+	representation::expansion<base> expansion_result
+		= representation::expand<base>(original_fraction);
+	std::print("\nInput: {}\nBase: {}\nWhat we want to get: {},\nOutput: {}",
+		original_fraction, base, expected_expansion, expansion_result);
+}
+
 void representation_tests() {
 	using namespace representation;
 	const int decimal = 10;
@@ -373,8 +604,15 @@ void representation_tests() {
 	representation_test<binary>(3, 2, "1", "1", "0");
 	representation_test<octal>(75, 56, "1", "2", "3");
 	representation_test<hexal>(91, 80, "1", "2", "3");
+	representation_test<decimal>(1, 97, "0", "",
+		"010309278350515463917525773195876288659793814432989690721649484536082474226804123711340206185567");
 	representation_test<decimal>("1", "0", "1", 91, 90);
 	representation_test<binary>("1", "00", "01", 13, 12);
 	representation_test<octal>("10", "01", "12", 32329, 4032);
 	representation_test<hexal>("10", "ca", "0", 2149, 128);
+	representation_test<decimal>(
+		number_theory::big_integer{ "300000000000000000001" }, 3,
+		"100000000000000000000", "", "3");
+	representation_test<binary>(1, number_theory::big_integer{ 1 } << 70,
+		"0", std::string(69, '0') + "1", "");
 }
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+#include <concepts>
+namespace number_theory
+{
+    /*types with the arithmetic of the built-in integers: the std::integral
+     * types and big_integer, which does not overflow. Templates over these
+     * types, such as the fractions of gaussian elimination and of the
+     * representations of numbers, call gcd unqualified after using std::gcd,
+     * so the gcd of big_integer is found by argument-dependent lookup*/
+    template <typename I>
+    concept integer_like = std::regular<I> && std::totally_ordered<I> && std::constructible_from<I, int> &&
+        requires(I a, I b) {
+            { a + b } -> std::convertible_to<I>;
+            { a - b } -> std::convertible_to<I>;
+            { a * b } -> std::convertible_to<I>;
+            { a / b } -> std::convertible_to<I>;
+            { a % b } -> std::convertible_to<I>;
+            { -a } -> std::convertible_to<I>;
+        };
+}
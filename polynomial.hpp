@@ -2,16 +2,1290 @@
 #include <stdio.h>
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <format>
 #include <iostream>
+#include <limits>
+#include <numeric>
 #include <print>
 #include <set>
+#include <span>
 #include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "Number_theory.hpp"
+
 
 namespace polynomial {
+/*
+    description:
+        Element of the field of integers modulo the prime mod. Polynomials
+   with modular coefficients are computed exactly, which lets division and
+   gcd use the fast algorithms (Newton inversion and half-gcd) and lets the
+   integer gcd work prime by prime without coefficient growth.
+*/
+template <std::uint32_t mod>
+struct modular {
+  static constexpr std::uint32_t modulus{mod};
+  std::uint32_t value{};
+
+  constexpr modular() = default;
+  template <std::integral I>
+  constexpr modular(I x) : value{reduce(x)} {}
+
+  /*
+      description:
+          Multiplicative inverse by number_theory::modular_inverse, throws
+     std::invalid_argument for zero.
+  */
+  constexpr auto inverse() const -> modular {
+    return modular{number_theory::modular_inverse<mod>(std::int64_t{value})};
+  }
+  constexpr auto operator-() const -> modular {
+    modular result{};
+    result.value = value == 0 ? 0 : mod - value;
+    return result;
+  }
+  constexpr auto operator+=(modular x) -> modular & {
+    value = static_cast<std::uint32_t>((std::uint64_t{value} + x.value) % mod);
+    return *this;
+  }
+  constexpr auto operator-=(modular x) -> modular & {
+    return operator+=(-x);
+  }
+  constexpr auto operator*=(modular x) -> modular & {
+    value = static_cast<std::uint32_t>(std::uint64_t{value} * x.value % mod);
+    return *this;
+  }
+  constexpr auto operator/=(modular x) -> modular & {
+    return operator*=(x.inverse());
+  }
+  friend constexpr auto operator+(modular a, modular b) -> modular {
+    return a += b;
+  }
+  friend constexpr auto operator-(modular a, modular b) -> modular {
+    return a -= b;
+  }
+  friend constexpr auto operator*(modular a, modular b) -> modular {
+    return a *= b;
+  }
+  friend constexpr auto operator/(modular a, modular b) -> modular {
+    return a /= b;
+  }
+  friend constexpr auto operator==(const modular &, const modular &)
+      -> bool = default;
+
+ private:
+  template <std::integral I>
+  static constexpr auto reduce(I x) -> std::uint32_t {
+    if constexpr (std::is_signed_v<I>) {
+      const long long r{static_cast<long long>(x) %
+                        static_cast<long long>(mod)};
+      return static_cast<std::uint32_t>(r < 0 ? r + mod : r);
+    } else {
+      return static_cast<std::uint32_t>(static_cast<std::uint64_t>(x) % mod);
+    }
+  }
+};
+template <typename T>
+inline constexpr bool is_modular_v{false};
+template <std::uint32_t mod>
+inline constexpr bool is_modular_v<modular<mod>>{true};
+/*
+    description:
+        Strategies for multiplying coefficient sequences. multiply() picks one
+   by the length of the shorter factor: the schoolbook product for short
+   factors, Karatsuba in the middle and, for integer coefficients, a
+   number-theoretic transform over three NTT-friendly primes whose results
+   are combined with the Chinese remainder theorem.
+*/
+namespace multiplication {
+/*
+    description:
+        Shorter factors than this are multiplied by the schoolbook method,
+   also the size at which Karatsuba stops recursing.
+*/
+inline constexpr std::size_t karatsuba_threshold{64};
+/*
+    description:
+        Integer factors at least this long are multiplied with the NTT. Its
+   three transforms and the CRT only beat Karatsuba for long factors.
+*/
+inline constexpr std::size_t ntt_threshold{32768};
+/*
+    description:
+        Factors with coefficients modulo one of the NTT primes need a single
+   transform, so the NTT pays off for them much earlier.
+*/
+inline constexpr std::size_t modular_ntt_threshold{128};
+/*
+    description:
+        Adds the product of a and b to out, out must hold
+   a.size() + b.size() - 1 coefficients.
+    parameters:
+        a, b - the factors
+        out - the accumulator
+*/
+template <typename T>
+inline auto schoolbook(std::span<const T> a, std::span<const T> b,
+                       std::span<T> out) -> void {
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    const T factor{a[i]};
+    T *row{out.data() + i};
+    for (std::size_t j = 0; j < b.size(); ++j) {
+      row[j] += factor * b[j];
+    }
+  }
+}
+/*
+    description:
+        Writes the product of a and b (both n coefficients long) to the
+   2n - 1 coefficients of out. Splitting a = a0 + x^h a1, b = b0 + x^h b1
+   needs only three half-size products: a0 b0, a1 b1 and
+   (a0 + a1)(b0 + b1), from which the middle term is recovered.
+    parameters:
+        a, b - the factors
+        out - the product
+        scratch - temporary storage, every level of the recursion takes
+   4 ceil(n / 2) coefficients, 8n always suffice
+*/
+template <typename T>
+inline auto karatsuba_square(const T *a, const T *b, std::size_t n, T *out,
+                             T *scratch) -> void {
+  if (n < karatsuba_threshold) {
+    std::fill(out, out + 2 * n - 1, T{0});
+    schoolbook<T>({a, n}, {b, n}, {out, 2 * n - 1});
+    return;
+  }
+  const std::size_t low{n / 2};
+  const std::size_t high{n - low};
+  T *sum_a{scratch};
+  T *sum_b{scratch + high};
+  T *middle{scratch + 2 * high};
+  T *next{scratch + 4 * high};
+  for (std::size_t i = 0; i < high; ++i) {
+    sum_a[i] = a[low + i] + (i < low ? a[i] : T{0});
+    sum_b[i] = b[low + i] + (i < low ? b[i] : T{0});
+  }
+  karatsuba_square(a, b, low, out, next);
+  out[2 * low - 1] = T{0};
+  karatsuba_square(a + low, b + low, high, out + 2 * low, next);
+  karatsuba_square(sum_a, sum_b, high, middle, next);
+  for (std::size_t i = 0; i < 2 * low - 1; ++i) {
+    middle[i] -= out[i];
+  }
+  for (std::size_t i = 0; i < 2 * high - 1; ++i) {
+    middle[i] -= out[2 * low + i];
+  }
+  for (std::size_t i = 0; i < 2 * high - 1; ++i) {
+    out[low + i] += middle[i];
+  }
+}
+/*
+    description:
+        Karatsuba multiplication of factors of any lengths: the longer factor
+   is cut into blocks as long as the shorter one and every block is
+   multiplied with the Karatsuba method.
+    parameters:
+        a, b - the factors
+    return:
+        std::vector<T> - a.size() + b.size() - 1 coefficients of the product
+*/
+template <typename T>
+inline auto karatsuba(std::span<const T> a, std::span<const T> b)
+    -> std::vector<T> {
+  if (a.size() < b.size()) {
+    std::swap(a, b);
+  }
+  const std::size_t n{b.size()};
+  std::vector<T> result(a.size() + n - 1, T{0});
+  std::vector<T> block(n, T{0});
+  std::vector<T> product(2 * n - 1);
+  std::vector<T> scratch(8 * n + karatsuba_threshold);
+  for (std::size_t start = 0; start < a.size(); start += n) {
+    const std::size_t length{std::min(n, a.size() - start)};
+    std::copy_n(a.data() + start, length, block.data());
+    std::fill(block.begin() + static_cast<std::ptrdiff_t>(length), block.end(),
+              T{0});
+    karatsuba_square(block.data(), b.data(), n, product.data(),
+                     scratch.data());
+    const std::size_t used{std::min(product.size(), result.size() - start)};
+    for (std::size_t i = 0; i < used; ++i) {
+      result[start + i] += product[i];
+    }
+  }
+  return result;
+}
+/*
+    description:
+        Prime mod = c * 2^k + 1 with primitive root root, the transform length
+   can be any power of two up to 2^k.
+*/
+template <std::uint32_t mod, std::uint32_t root>
+struct ntt_prime {
+  static constexpr std::uint32_t modulus{mod};
+  static constexpr std::size_t max_length{std::size_t{1}
+                                          << std::countr_zero(mod - 1)};
+  /*
+      description:
+          In-place iterative radix-2 transform of a (the length is a power of
+     two), the inverse transform includes the division by the length.
+  */
+  static auto transform(std::vector<std::uint32_t> &a, bool inverse) -> void {
+    const std::size_t n{a.size()};
+    for (std::size_t i = 1, j = 0; i < n; ++i) {
+      std::size_t bit{n >> 1};
+      for (; (j & bit) != 0; bit >>= 1) {
+        j ^= bit;
+      }
+      j ^= bit;
+      if (i < j) {
+        std::swap(a[i], a[j]);
+      }
+    }
+    std::vector<std::uint32_t> powers(n / 2);
+    for (std::size_t length = 2; length <= n; length <<= 1) {
+      std::uint64_t step{number_theory::modular_pow<mod>(std::uint64_t{root},
+                                                         (mod - 1) / length)};
+      if (inverse) {
+        step = static_cast<std::uint64_t>(number_theory::modular_inverse<mod>(
+            static_cast<std::int64_t>(step)));
+      }
+      const std::size_t half{length / 2};
+      powers[0] = 1;
+      for (std::size_t k = 1; k < half; ++k) {
+        powers[k] = static_cast<std::uint32_t>(powers[k - 1] * step % mod);
+      }
+      for (std::size_t start = 0; start < n; start += length) {
+        for (std::size_t k = 0; k < half; ++k) {
+          const std::uint32_t u{a[start + k]};
+          const auto v{static_cast<std::uint32_t>(
+              std::uint64_t{a[start + k + half]} * powers[k] % mod)};
+          a[start + k] = u + v < mod ? u + v : u + v - mod;
+          a[start + k + half] = u >= v ? u - v : u + mod - v;
+        }
+      }
+    }
+    if (inverse) {
+      const auto n_inverse{static_cast<std::uint64_t>(
+          number_theory::modular_inverse<mod>(static_cast<std::int64_t>(n)))};
+      for (auto &x : a) {
+        x = static_cast<std::uint32_t>(x * n_inverse % mod);
+      }
+    }
+  }
+  /*
+      description:
+          Residues modulo mod of the coefficients of the product of a and b.
+  */
+  template <typename T>
+  static auto multiply(std::span<const T> a, std::span<const T> b)
+      -> std::vector<std::uint32_t> {
+    const std::size_t length{a.size() + b.size() - 1};
+    const std::size_t n{std::bit_ceil(length)};
+    std::vector<std::uint32_t> fa(n, 0);
+    std::vector<std::uint32_t> fb(n, 0);
+    std::ranges::transform(a, fa.begin(), residue<T>);
+    std::ranges::transform(b, fb.begin(), residue<T>);
+    transform(fa, false);
+    transform(fb, false);
+    for (std::size_t i = 0; i < n; ++i) {
+      fa[i] = static_cast<std::uint32_t>(std::uint64_t{fa[i]} * fb[i] % mod);
+    }
+    transform(fa, true);
+    fa.resize(length);
+    return fa;
+  }
+  template <typename T>
+  static auto residue(T value) -> std::uint32_t {
+    if constexpr (is_modular_v<T>) {
+      return value.value % mod;
+    } else if constexpr (std::is_signed_v<T>) {
+      const long long r{static_cast<long long>(value) %
+                        static_cast<long long>(mod)};
+      return static_cast<std::uint32_t>(r < 0 ? r + mod : r);
+    } else {
+      return static_cast<std::uint32_t>(value % mod);
+    }
+  }
+};
+using ntt_prime_1 = ntt_prime<998'244'353, 3>;
+using ntt_prime_2 = ntt_prime<167'772'161, 3>;
+using ntt_prime_3 = ntt_prime<469'762'049, 3>;
+/*
+    description:
+        Longest product the three primes can transform.
+*/
+inline constexpr std::size_t ntt_max_length{
+    std::min({ntt_prime_1::max_length, ntt_prime_2::max_length,
+              ntt_prime_3::max_length})};
+template <typename T>
+inline constexpr bool is_ntt_field_v{false};
+template <std::uint32_t mod>
+inline constexpr bool is_ntt_field_v<modular<mod>>{
+    mod == ntt_prime_1::modulus || mod == ntt_prime_2::modulus ||
+    mod == ntt_prime_3::modulus};
+/*
+    description:
+        NTT multiplication of integer polynomials. The product is computed
+   modulo three primes (p1 p2 p3 > 2^87) and every coefficient is
+   reconstructed with Garner's form of the Chinese remainder theorem, so it is
+   exact whenever the true coefficient fits in T.
+    parameters:
+        a, b - the factors, a.size() + b.size() - 1 must not exceed
+   ntt_max_length
+    return:
+        std::vector<T> - a.size() + b.size() - 1 coefficients of the product
+*/
+template <std::integral T>
+inline auto ntt(std::span<const T> a, std::span<const T> b) -> std::vector<T> {
+  constexpr std::uint64_t p1{ntt_prime_1::modulus};
+  constexpr std::uint64_t p2{ntt_prime_2::modulus};
+  constexpr std::uint64_t p3{ntt_prime_3::modulus};
+  constexpr auto p1_inverse_2{static_cast<std::uint64_t>(
+      number_theory::modular_inverse<p2>(static_cast<std::int64_t>(p1)))};
+  constexpr auto p12_inverse_3{static_cast<std::uint64_t>(
+      number_theory::modular_inverse<p3>(static_cast<std::int64_t>(p1 * p2 % p3)))};
+  constexpr unsigned __int128 p12{static_cast<unsigned __int128>(p1) * p2};
+  constexpr unsigned __int128 p123{p12 * p3};
+
+  const auto r1{ntt_prime_1::multiply(a, b)};
+  const auto r2{ntt_prime_2::multiply(a, b)};
+  const auto r3{ntt_prime_3::multiply(a, b)};
+  std::vector<T> result(r1.size());
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    const std::uint64_t x1{r1[i]};
+    const std::uint64_t x2{(r2[i] + p2 - x1 % p2) * p1_inverse_2 % p2};
+    const std::uint64_t partial{(x1 + p1 % p3 * x2) % p3};
+    const std::uint64_t x3{(r3[i] + p3 - partial) * p12_inverse_3 % p3};
+    const unsigned __int128 value{x1 + static_cast<unsigned __int128>(p1) * x2 +
+                                  p12 * x3};
+    if constexpr (std::is_signed_v<T>) {
+      result[i] = static_cast<T>(value > p123 / 2
+                                     ? static_cast<__int128>(value) -
+                                           static_cast<__int128>(p123)
+                                     : static_cast<__int128>(value));
+    } else {
+      result[i] = static_cast<T>(value);
+    }
+  }
+  return result;
+}
+/*
+    description:
+        Product of two coefficient sequences with the strategy chosen by the
+   length of the shorter one.
+    parameters:
+        a, b - the factors, both non-empty
+    return:
+        std::vector<T> - a.size() + b.size() - 1 coefficients of the product
+*/
+template <typename T>
+inline auto multiply(std::span<const T> a, std::span<const T> b)
+    -> std::vector<T> {
+  const std::size_t shorter{std::min(a.size(), b.size())};
+  if (shorter < karatsuba_threshold) {
+    std::vector<T> result(a.size() + b.size() - 1, T{0});
+    schoolbook<T>(a, b, result);
+    return result;
+  }
+  if constexpr (is_ntt_field_v<T>) {
+    using prime = ntt_prime<T::modulus, 3>;
+    if (shorter >= modular_ntt_threshold &&
+        a.size() + b.size() - 1 <= prime::max_length) {
+      const auto residues{prime::multiply(a, b)};
+      return {residues.begin(), residues.end()};
+    }
+  } else if constexpr (std::integral<T> &&
+                       sizeof(T) >= sizeof(std::uint32_t) &&
+                       sizeof(T) <= sizeof(std::uint64_t)) {
+    if (shorter >= ntt_threshold &&
+        a.size() + b.size() - 1 <= ntt_max_length) {
+      return ntt(a, b);
+    }
+  }
+  return karatsuba(a, b);
+}
+}  // namespace multiplication
+/*
+    description:
+        Division of coefficient sequences over a field (modular or floating
+   point coefficients). Sequences are stored from the constant term up
+   and are trimmed, so the zero polynomial is the empty sequence.
+*/
+namespace division {
+/*
+    description:
+        Quotients shorter than this, or divisors shorter than this, are
+   computed by long division. Longer ones use Newton inversion.
+*/
+inline constexpr std::size_t newton_threshold{64};
+/*
+    description:
+        Removes leading zero coefficients.
+*/
+template <typename T>
+inline auto trim(std::vector<T> &a) -> void {
+  while (!a.empty() && a.back() == T{0}) {
+    a.pop_back();
+  }
+}
+/*
+    description:
+        First n coefficients of the power series 1 / a by Newton iteration,
+   b <- b (2 - a b), which doubles the number of correct coefficients on
+   every step, so the whole inversion costs a constant number of
+   multiplications of length n.
+    parameters:
+        a - the series, a[0] must be invertible
+        n - the number of coefficients to compute
+    return:
+        std::vector<T> - the first n coefficients of 1 / a
+*/
+template <typename T>
+inline auto inverse_series(std::span<const T> a, std::size_t n)
+    -> std::vector<T> {
+  std::vector<T> b{T{1} / a[0]};
+  for (std::size_t length = 1; length < n;) {
+    length = std::min(2 * length, n);
+    auto error{multiplication::multiply(a.first(std::min(a.size(), length)),
+                                        std::span<const T>{b})};
+    error.resize(length, T{0});
+    for (auto &c : error) {
+      c = -c;
+    }
+    error[0] += T{2};
+    b = multiplication::multiply(std::span<const T>{b},
+                                 std::span<const T>{error});
+    b.resize(length, T{0});
+  }
+  b.resize(n, T{0});
+  return b;
+}
+/*
+    description:
+        Quotient and remainder of a divided by b. Long ones are computed from
+   rev(q) = rev(a) / rev(b) mod x^(deg a - deg b + 1), where rev reverses
+   the coefficients, so division costs as much as a few multiplications.
+    parameters:
+        a - the dividend
+        b - the divisor, trimmed and non-zero
+    return:
+        std::pair<std::vector<T>, std::vector<T>> - the quotient and the
+   remainder, both trimmed
+*/
+template <typename T>
+inline auto divide(std::span<const T> a, std::span<const T> b)
+    -> std::pair<std::vector<T>, std::vector<T>> {
+  if (a.size() < b.size()) {
+    std::vector<T> remainder(a.begin(), a.end());
+    trim(remainder);
+    return {{}, remainder};
+  }
+  const std::size_t quotient_size{a.size() - b.size() + 1};
+  std::vector<T> quotient(quotient_size, T{0});
+  if (quotient_size < newton_threshold || b.size() < newton_threshold) {
+    std::vector<T> remainder(a.begin(), a.end());
+    const T inverse_leading{T{1} / b.back()};
+    for (std::size_t i = quotient_size; i-- > 0;) {
+      const T factor{remainder[i + b.size() - 1] * inverse_leading};
+      quotient[i] = factor;
+      for (std::size_t j = 0; j < b.size(); ++j) {
+        remainder[i + j] -= factor * b[j];
+      }
+    }
+    remainder.resize(b.size() - 1);
+    trim(quotient);
+    trim(remainder);
+    return {quotient, remainder};
+  }
+  std::vector<T> reversed_a(a.rbegin(),
+                            a.rbegin() + static_cast<std::ptrdiff_t>(
+                                             quotient_size));
+  std::vector<T> reversed_b(b.rbegin(), b.rend());
+  const auto inverse{inverse_series(std::span<const T>{reversed_b},
+                                    quotient_size)};
+  quotient = multiplication::multiply(std::span<const T>{reversed_a},
+                                      std::span<const T>{inverse});
+  quotient.resize(quotient_size);
+  std::ranges::reverse(quotient);
+  const auto product{multiplication::multiply(
+      std::span<const T>{quotient}, b.first(b.size() - 1))};
+  std::vector<T> remainder(a.begin(),
+                           a.begin() + static_cast<std::ptrdiff_t>(
+                                           b.size() - 1));
+  for (std::size_t i = 0; i < remainder.size(); ++i) {
+    remainder[i] -= product[i];
+  }
+  trim(quotient);
+  trim(remainder);
+  return {quotient, remainder};
+}
+}  // namespace division
+/*
+    description:
+        Half-gcd algorithm for the gcd of polynomials over a field in
+   O(M(n) log n). Instead of computing the remainder sequence one division
+   at a time, half_gcd finds from the leading halves of the polynomials the
+   2x2 matrix of the steps that halve the degree, applies it once and
+   recurses.
+*/
+namespace half_gcd {
+/*
+    description:
+        Polynomials of lower degree are handled by the plain Euclidean
+   algorithm.
+*/
+inline constexpr std::size_t half_gcd_threshold{1024};
+/*
+    description:
+        Matrix [[a00, a01], [a10, a11]] with polynomial entries, the product
+   of the Euclidean steps [[0, 1], [1, -q]] made so far.
+*/
+template <typename T>
+struct transformation {
+  std::vector<T> a00{T{1}};
+  std::vector<T> a01{};
+  std::vector<T> a10{};
+  std::vector<T> a11{T{1}};
+};
+template <typename T>
+inline auto add(std::vector<T> a, const std::vector<T> &b) -> std::vector<T> {
+  if (a.size() < b.size()) {
+    a.resize(b.size(), T{0});
+  }
+  for (std::size_t i = 0; i < b.size(); ++i) {
+    a[i] += b[i];
+  }
+  division::trim(a);
+  return a;
+}
+template <typename T>
+inline auto product(const std::vector<T> &a, const std::vector<T> &b)
+    -> std::vector<T> {
+  if (a.empty() || b.empty()) {
+    return {};
+  }
+  auto result{multiplication::multiply(std::span<const T>{a},
+                                       std::span<const T>{b})};
+  division::trim(result);
+  return result;
+}
+/*
+    description:
+        Returns the pair m * (p0, p1).
+*/
+template <typename T>
+inline auto apply(const transformation<T> &m, const std::vector<T> &p0,
+                  const std::vector<T> &p1)
+    -> std::pair<std::vector<T>, std::vector<T>> {
+  return {add(product(m.a00, p0), product(m.a01, p1)),
+          add(product(m.a10, p0), product(m.a11, p1))};
+}
+/*
+    description:
+        Returns the product s * r.
+*/
+template <typename T>
+inline auto compose(const transformation<T> &s, const transformation<T> &r)
+    -> transformation<T> {
+  return {add(product(s.a00, r.a00), product(s.a01, r.a10)),
+          add(product(s.a00, r.a01), product(s.a01, r.a11)),
+          add(product(s.a10, r.a00), product(s.a11, r.a10)),
+          add(product(s.a10, r.a01), product(s.a11, r.a11))};
+}
+/*
+    description:
+        Performs one Euclidean step on (p0, p1) and records it in m.
+*/
+template <typename T>
+inline auto euclidean_step(std::vector<T> &p0, std::vector<T> &p1,
+                           transformation<T> &m) -> void {
+  auto [quotient, remainder] =
+      division::divide(std::span<const T>{p0}, std::span<const T>{p1});
+  for (auto &c : quotient) {
+    c = -c;
+  }
+  m = {m.a10, m.a11, add(m.a00, product(quotient, m.a10)),
+       add(m.a01, product(quotient, m.a11))};
+  p0 = std::move(p1);
+  p1 = std::move(remainder);
+}
+template <typename T>
+inline auto drop_low(const std::vector<T> &a, std::size_t k) -> std::vector<T> {
+  if (a.size() <= k) {
+    return {};
+  }
+  return {a.begin() + static_cast<std::ptrdiff_t>(k), a.end()};
+}
+/*
+    description:
+        For deg p0 > deg p1 returns the matrix of the Euclidean steps that
+   take (p0, p1) to the first pair of consecutive remainders (r0, r1) with
+   deg r1 < ceil(deg p0 / 2) <= deg r0. Only the leading coefficients
+   determine these steps, so both halves of the work are recursive calls on
+   polynomials of half the degree.
+*/
+template <typename T>
+inline auto reduce(std::vector<T> p0, std::vector<T> p1) -> transformation<T> {
+  const std::size_t m{p0.size() / 2};
+  transformation<T> result{};
+  if (p1.size() <= m) {
+    return result;
+  }
+  if (p0.size() < half_gcd_threshold) {
+    while (p1.size() > m) {
+      euclidean_step(p0, p1, result);
+    }
+    return result;
+  }
+  result = reduce(drop_low(p0, m), drop_low(p1, m));
+  std::tie(p0, p1) = apply(result, p0, p1);
+  if (p1.size() <= m) {
+    return result;
+  }
+  euclidean_step(p0, p1, result);
+  if (p1.size() <= m) {
+    return result;
+  }
+  const std::size_t k{2 * m > p0.size() - 1 ? 2 * m - (p0.size() - 1) : 0};
+  return compose(reduce(drop_low(p0, k), drop_low(p1, k)), result);
+}
+/*
+    description:
+        Monic gcd of a and b.
+*/
+template <typename T>
+inline auto gcd(std::vector<T> a, std::vector<T> b) -> std::vector<T> {
+  division::trim(a);
+  division::trim(b);
+  if (a.size() < b.size()) {
+    std::swap(a, b);
+  }
+  while (!b.empty()) {
+    if (a.size() > b.size() && a.size() >= half_gcd_threshold) {
+      std::tie(a, b) = apply(reduce(a, b), a, b);
+      if (b.empty()) {
+        break;
+      }
+    }
+    auto remainder{division::divide(std::span<const T>{a},
+                                    std::span<const T>{b})
+                       .second};
+    a = std::move(b);
+    b = std::move(remainder);
+  }
+  if (!a.empty()) {
+    const T inverse_leading{T{1} / a.back()};
+    for (auto &c : a) {
+      c *= inverse_leading;
+    }
+  }
+  return a;
+}
+}  // namespace half_gcd
+/*
+    description:
+        Multi-prime gcd of integer polynomials. The Euclidean algorithm over
+   the rationals makes the coefficients grow exponentially, instead the gcd
+   is computed modulo several word-sized primes with half_gcd::gcd and the
+   images are combined with the Chinese remainder theorem until the result
+   divides both polynomials.
+*/
+namespace modular_gcd {
+using wide = __int128;
+/*
+    description:
+        Primes below 2^30 tried in order, a prime dividing a leading
+   coefficient is skipped, a prime giving a gcd of too high degree
+   (unlucky) is discarded. Four primes already give 120 bits.
+*/
+inline constexpr std::uint32_t primes[]{998'244'353, 469'762'049,
+                                        167'772'161, 754'974'721,
+                                        1'000'000'007, 1'000'000'009};
+template <typename I>
+inline auto content(const std::vector<I> &a) -> I {
+  I result{0};
+  for (const I c : a) {
+    I x{c < 0 ? -c : c};
+    while (x != 0) {
+      result %= x;
+      std::swap(result, x);
+    }
+  }
+  return result;
+}
+/*
+    description:
+        Checks whether g divides a exactly over the integers.
+*/
+template <std::integral T>
+inline auto divides(const std::vector<T> &a, const std::vector<wide> &g)
+    -> bool {
+  std::vector<wide> remainder(a.begin(), a.end());
+  const wide leading{g.back()};
+  for (std::size_t i = remainder.size(); i >= g.size() && i > 0; --i) {
+    const wide top{remainder[i - 1]};
+    if (top == 0) {
+      continue;
+    }
+    if (top % leading != 0) {
+      return false;
+    }
+    const wide factor{top / leading};
+    const std::size_t shift{i - g.size()};
+    for (std::size_t j = 0; j < g.size(); ++j) {
+      remainder[shift + j] -= factor * g[j];
+    }
+  }
+  return std::ranges::all_of(remainder, [](wide c) { return c == 0; });
+}
+/*
+    description:
+        gcd of two integer polynomials with positive leading coefficient.
+    parameters:
+        a, b - trimmed coefficient sequences
+    return:
+        std::vector<T> - the gcd, its content is the gcd of the contents
+*/
+template <std::integral T>
+inline auto gcd(std::vector<T> a, std::vector<T> b) -> std::vector<T> {
+  if (a.empty() || b.empty()) {
+    auto result{a.empty() ? b : a};
+    if (!result.empty() && result.back() < T{0}) {
+      for (auto &c : result) {
+        c = -c;
+      }
+    }
+    return result;
+  }
+  const T content_a{content(a)};
+  const T content_b{content(b)};
+  for (auto &c : a) {
+    c /= content_a;
+  }
+  for (auto &c : b) {
+    c /= content_b;
+  }
+  const T leading{content(std::vector<T>{a.back(), b.back()})};
+
+  const T common_content{content(std::vector<T>{content_a, content_b})};
+
+  std::vector<unsigned __int128> residues{};
+  unsigned __int128 modulus{0};
+  std::vector<wide> candidate{};
+  bool found{false};
+  auto try_prime = [&]<std::uint32_t p>() {
+    using field = modular<p>;
+    if (found || field{a.back()} == field{0} || field{b.back()} == field{0}) {
+      return;
+    }
+    auto image{half_gcd::gcd(std::vector<field>(a.begin(), a.end()),
+                             std::vector<field>(b.begin(), b.end()))};
+    for (auto &c : image) {
+      c *= field{leading};
+    }
+    if (modulus != 0 && image.size() > residues.size()) {
+      return;
+    }
+    if (modulus == 0 || image.size() < residues.size()) {
+      residues.assign(image.size(), 0);
+      std::ranges::transform(image, residues.begin(),
+                             [](field c) { return c.value; });
+      modulus = p;
+    } else {
+      if (modulus > (~static_cast<unsigned __int128>(0) >> 2) / p) {
+        return;
+      }
+      const field inverse{field{static_cast<std::uint64_t>(modulus % p)}
+                              .inverse()};
+      for (std::size_t i = 0; i < residues.size(); ++i) {
+        const field known{static_cast<std::uint64_t>(residues[i] % p)};
+        residues[i] += modulus * ((image[i] - known) * inverse).value;
+      }
+      modulus *= p;
+    }
+    candidate.assign(residues.size(), 0);
+    for (std::size_t i = 0; i < residues.size(); ++i) {
+      candidate[i] = residues[i] > modulus / 2
+                         ? static_cast<wide>(residues[i]) -
+                               static_cast<wide>(modulus)
+                         : static_cast<wide>(residues[i]);
+    }
+    const wide candidate_content{content(candidate)};
+    for (auto &c : candidate) {
+      c /= candidate_content;
+    }
+    found = divides(a, candidate) && divides(b, candidate);
+  };
+  [&]<std::size_t... I>(std::index_sequence<I...>) {
+    (try_prime.template operator()<primes[I]>(), ...);
+  }(std::make_index_sequence<std::size(primes)>{});
+  if (!found) {
+    throw std::overflow_error("Coefficients of the gcd are too large");
+  }
+  const T sign{candidate.back() < 0 ? T{-1} : T{1}};
+  std::vector<T> result(candidate.size());
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    result[i] = static_cast<T>(candidate[i]) * sign * common_content;
+  }
+  return result;
+}
+}  // namespace modular_gcd
+/*
+    description:
+        Evaluation of one coefficient sequence at many points. Horner's rule
+   is a chain of dependent multiply-adds, so horner() runs it on a block of
+   points at once: the compiler turns the block into SIMD multiply-adds and
+   the independent chains hide each other's latency. A single point of high
+   degree is evaluated with Estrin's scheme, whose levels are independent.
+   Modular polynomials of high degree are evaluated at many points with the
+   subproduct tree, and large batches are split between threads.
+*/
+namespace evaluation {
+/*
+    description:
+        Number of points evaluated together by horner().
+*/
+inline constexpr std::size_t lanes{8};
+/*
+    description:
+        Single points, batches shorter than lanes and the points left over
+   from the blocks are evaluated with Estrin's scheme from this many
+   coefficients on.
+*/
+inline constexpr std::size_t estrin_threshold{256};
+/*
+    description:
+        The subproduct tree is used when both the number of coefficients and
+   the number of points reach this threshold. Its leaves hold up to
+   subproduct_leaf points, evaluated with horner().
+*/
+inline constexpr std::size_t subproduct_threshold{2048};
+inline constexpr std::size_t subproduct_leaf{64};
+/*
+    description:
+        Batches costing fewer coefficient-point products than this are
+   evaluated on the calling thread.
+*/
+inline constexpr std::size_t parallel_work{1 << 20};
+/*
+    description:
+        Value of a at x by Estrin's scheme: neighbouring coefficients are
+   paired into a[2i] + a[2i + 1] x, which is a polynomial in x^2 of half
+   the length, until one coefficient is left.
+    parameters:
+        a - the coefficients from the constant term up
+        x - the point
+    return:
+        T - a(x)
+*/
+template <typename T>
+inline auto estrin(std::span<const T> a, T x) -> T {
+  if (a.empty()) {
+    return T{0};
+  }
+  std::vector<T> level(a.begin(), a.end());
+  while (level.size() > 1) {
+    const std::size_t half{level.size() / 2};
+    for (std::size_t i = 0; i < half; ++i) {
+      level[i] = level[2 * i] + level[2 * i + 1] * x;
+    }
+    if (level.size() % 2 == 1) {
+      level[half] = level.back();
+      level.resize(half + 1);
+    } else {
+      level.resize(half);
+    }
+    if (level.size() > 1) {
+      x *= x;
+    }
+  }
+  return level.front();
+}
+/*
+    description:
+        Horner's rule on blocks of lanes points, the remaining points are
+   evaluated one by one.
+    parameters:
+        a - the coefficients from the constant term up
+        points - the points
+        results - receives a(points[i]) at index i
+*/
+template <typename T>
+inline auto horner(std::span<const T> a, std::span<const T> points,
+                   std::span<T> results) -> void {
+  if (a.empty()) {
+    std::ranges::fill(results, T{0});
+    return;
+  }
+  std::size_t i = 0;
+  for (; i + lanes <= points.size(); i += lanes) {
+    std::array<T, lanes> x{};
+    std::array<T, lanes> accumulator{};
+    for (std::size_t l = 0; l < lanes; ++l) {
+      x[l] = points[i + l];
+      accumulator[l] = a.back();
+    }
+    for (std::size_t k = a.size() - 1; k-- > 0;) {
+      const T c{a[k]};
+      for (std::size_t l = 0; l < lanes; ++l) {
+        accumulator[l] = accumulator[l] * x[l] + c;
+      }
+    }
+    std::ranges::copy(accumulator, results.begin() +
+                                       static_cast<std::ptrdiff_t>(i));
+  }
+  for (; i < points.size(); ++i) {
+    if (a.size() >= estrin_threshold) {
+      results[i] = estrin(a, points[i]);
+      continue;
+    }
+    T result{a.back()};
+    for (std::size_t k = a.size() - 1; k-- > 0;) {
+      result = result * points[i] + a[k];
+    }
+    results[i] = result;
+  }
+}
+/*
+    description:
+        Fills tree[node] with the product of (x - p) over the points p and
+   recurses into the halves, children of node are 2 node + 1 and
+   2 node + 2.
+*/
+template <typename T>
+inline auto build_subproduct_tree(std::span<const T> points,
+                                  std::vector<std::vector<T>> &tree,
+                                  std::size_t node) -> void {
+  if (points.size() <= subproduct_leaf) {
+    std::vector<T> product{T{1}};
+    product.reserve(points.size() + 1);
+    for (const T p : points) {
+      product.push_back(T{0});
+      for (std::size_t j = product.size() - 1; j > 0; --j) {
+        product[j] = product[j - 1] - p * product[j];
+      }
+      product[0] = -p * product[0];
+    }
+    tree[node] = std::move(product);
+    return;
+  }
+  const std::size_t middle{points.size() / 2};
+  build_subproduct_tree(points.first(middle), tree, 2 * node + 1);
+  build_subproduct_tree(points.subspan(middle), tree, 2 * node + 2);
+  tree[node] = multiplication::multiply(
+      std::span<const T>{tree[2 * node + 1]},
+      std::span<const T>{tree[2 * node + 2]});
+}
+/*
+    description:
+        a(p) = (a mod (x - p))(p), so the remainder of a by the product of a
+   node is passed down, reduced by the products of the children, until the
+   remainders are short enough for horner().
+*/
+template <typename T>
+inline auto descend_subproduct_tree(std::vector<T> remainder,
+                                    std::span<const T> points,
+                                    const std::vector<std::vector<T>> &tree,
+                                    std::size_t node, std::span<T> results)
+    -> void {
+  if (points.size() <= subproduct_leaf) {
+    horner(std::span<const T>{remainder}, points, results);
+    return;
+  }
+  const std::size_t middle{points.size() / 2};
+  for (const std::size_t child : {std::size_t{1}, std::size_t{2}}) {
+    auto reduced{division::divide(std::span<const T>{remainder},
+                                  std::span<const T>{tree[2 * node + child]})
+                     .second};
+    const std::size_t begin{child == 1 ? 0 : middle};
+    const std::size_t count{child == 1 ? middle : points.size() - middle};
+    descend_subproduct_tree(std::move(reduced),
+                            points.subspan(begin, count), tree,
+                            2 * node + child, results.subspan(begin, count));
+  }
+}
+/*
+    description:
+        Multipoint evaluation with the subproduct tree in
+   O(M(n) log n), where M(n) is the cost of a product of length n.
+    parameters:
+        a - the coefficients from the constant term up
+        points - the points
+        results - receives a(points[i]) at index i
+*/
+template <typename T>
+  requires is_modular_v<T>
+inline auto subproduct_tree(std::span<const T> a, std::span<const T> points,
+                            std::span<T> results) -> void {
+  std::vector<std::vector<T>> tree(4 * (points.size() / subproduct_leaf + 1));
+  build_subproduct_tree(points, tree, 0);
+  auto remainder{division::divide(a, std::span<const T>{tree[0]}).second};
+  descend_subproduct_tree(std::move(remainder), points, tree, 0, results);
+}
+/*
+    description:
+        Evaluates a at every point on the calling thread, with the
+   subproduct tree when it pays off and with horner() otherwise.
+*/
+template <typename T>
+inline auto evaluate_sequential(std::span<const T> a,
+                                std::span<const T> points,
+                                std::span<T> results) -> void {
+  if constexpr (is_modular_v<T>) {
+    if (a.size() >= subproduct_threshold &&
+        points.size() >= subproduct_threshold) {
+      subproduct_tree(a, points, results);
+      return;
+    }
+  }
+  horner(a, points, results);
+}
+/*
+    description:
+        Evaluates a at every point. The points are cut into consecutive
+   chunks, one per hardware thread, once the batch costs more than
+   parallel_work coefficient-point products. Chunks stay long enough for
+   the subproduct tree when the whole batch would use it.
+    parameters:
+        a - the coefficients from the constant term up
+        points - the points
+        results - receives a(points[i]) at index i, as long as points
+*/
+template <typename T>
+inline auto evaluate(std::span<const T> a, std::span<const T> points,
+                     std::span<T> results) -> void {
+  const std::size_t count{points.size()};
+  std::size_t threads{std::clamp<std::size_t>(
+      a.size() * count / parallel_work, 1,
+      std::max(1U, std::thread::hardware_concurrency()))};
+  if (is_modular_v<T> && a.size() >= subproduct_threshold &&
+      count >= subproduct_threshold) {
+    threads = std::min(threads, count / subproduct_threshold);
+  }
+  threads = std::min(threads, std::max<std::size_t>(count / lanes, 1));
+  if (threads == 1) {
+    evaluate_sequential(a, points, results);
+    return;
+  }
+  const std::size_t chunk{(count + threads - 1) / threads};
+  std::vector<std::jthread> workers;
+  workers.reserve(threads);
+  for (std::size_t begin = 0; begin < count; begin += chunk) {
+    const std::size_t length{std::min(chunk, count - begin)};
+    workers.emplace_back([=] {
+      evaluate_sequential(a, points.subspan(begin, length),
+                          results.subspan(begin, length));
+    });
+  }
+}
+}  // namespace evaluation
+/*
+    description:
+        Rational roots of integer polynomials. By the rational root theorem
+   a root p / q in lowest terms has p dividing the constant term and q the
+   leading coefficient, so both are factored with number_theory::factorize
+   and the candidates are built from their divisors.
+   Candidates are discarded cheaply first, q - p has to divide a(1) and
+   q + p has to divide a(-1). A root is also a root modulo every prime not
+   dividing q, so the rest are evaluated modulo a few primes with
+   evaluation::evaluate, which handles a whole block at once and splits it
+   between threads. Only the survivors are divided out exactly, and every
+   root found deflates the polynomial before the next block is tried.
+*/
+namespace rational_root_search {
+using wide = __int128;
+/*
+    description:
+        Candidates are generated and pruned in blocks of this many, so a
+   constant term and a leading coefficient with many divisors never hold
+   all the pairs in memory and roots found early shrink later blocks.
+*/
+inline constexpr std::size_t block_size{1 << 16};
+/*
+    description:
+        Primes used to discard candidates. A non-root survives a prime with
+   probability about degree / prime, so three of them leave practically
+   only the roots.
+*/
+inline constexpr std::uint32_t primes[]{998'244'353, 1'000'000'007,
+                                        1'000'000'009};
+/*
+    description:
+        All positive divisors of n > 0 in increasing order, from its
+   factorization by number_theory::factorize.
+*/
+inline auto divisors(std::uint64_t n) -> std::vector<std::uint64_t> {
+  std::vector<std::uint64_t> result{1};
+  for (const auto &[prime, exponent] : number_theory::factorize(n)) {
+    const std::size_t count{result.size()};
+    std::uint64_t power{1};
+    for (int k = 0; k < exponent; ++k) {
+      power *= prime;
+      for (std::size_t j = 0; j < count; ++j) {
+        result.push_back(result[j] * power);
+      }
+    }
+  }
+  std::ranges::sort(result);
+  return result;
+}
+template <std::signed_integral T>
+inline auto magnitude(T x) -> std::uint64_t {
+  return x < 0 ? std::uint64_t{0} - static_cast<std::uint64_t>(x)
+               : static_cast<std::uint64_t>(x);
+}
+/*
+    description:
+        Discards the candidates p / q at which a does not vanish modulo
+   prime. The points p q^-1 of one block are evaluated together, a
+   candidate whose q is divisible by prime cannot be tested and is kept.
+*/
+template <std::uint32_t prime, std::signed_integral T>
+inline auto prune(const std::vector<T> &a,
+                  std::vector<std::pair<T, T>> &candidates) -> void {
+  using field = modular<prime>;
+  const std::vector<field> coefficients(a.begin(), a.end());
+  std::vector<field> points(candidates.size());
+  for (std::size_t i = 0; i < candidates.size(); ++i) {
+    const field q{candidates[i].second};
+    points[i] = q == field{0} ? field{0}
+                              : field{candidates[i].first} * q.inverse();
+  }
+  std::vector<field> values(points.size());
+  evaluation::evaluate(std::span<const field>{coefficients},
+                       std::span<const field>{points},
+                       std::span<field>{values});
+  std::size_t kept{0};
+  for (std::size_t i = 0; i < candidates.size(); ++i) {
+    if (values[i] == field{0} || field{candidates[i].second} == field{0}) {
+      candidates[kept++] = candidates[i];
+    }
+  }
+  candidates.resize(kept);
+}
+/*
+    description:
+        Divides a by q x - p when p / q is a root. The quotient b is built
+   from the top, b[k - 1] = (a[k] + p b[k]) / q, in 128-bit arithmetic and
+   the first division that is not exact rejects the candidate, so most
+   non-roots stop after a few coefficients.
+    return:
+        bool - whether p / q is a root, a is replaced by the quotient if so
+   and left unchanged otherwise (also when the quotient overflows T)
+*/
+template <std::signed_integral T>
+inline auto deflate(std::vector<T> &a, T p, T q) -> bool {
+  std::vector<T> quotient(a.size() - 1);
+  wide upper{0};
+  for (std::size_t k = a.size() - 1; k > 0; --k) {
+    const wide numerator{wide{a[k]} + wide{p} * upper};
+    if (numerator % q != 0) {
+      return false;
+    }
+    upper = numerator / q;
+    if (upper < std::numeric_limits<T>::min() ||
+        upper > std::numeric_limits<T>::max()) {
+      return false;
+    }
+    quotient[k - 1] = static_cast<T>(upper);
+  }
+  if (wide{a[0]} + wide{p} * upper != 0) {
+    return false;
+  }
+  a = std::move(quotient);
+  return true;
+}
+/*
+    description:
+        Rational roots of a with multiplicity, as (numerator, positive
+   denominator) pairs in lowest terms sorted by value. The zero polynomial
+   has no finite list of roots and gives an empty one.
+*/
+template <std::signed_integral T>
+inline auto find(std::vector<T> a) -> std::vector<std::pair<T, T>> {
+  division::trim(a);
+  std::vector<std::pair<T, T>> roots{};
+  if (a.empty()) {
+    return roots;
+  }
+  const auto zeros{static_cast<std::size_t>(
+      std::ranges::find_if(a, [](T c) { return c != T{0}; }) - a.begin())};
+  roots.assign(zeros, {T{0}, T{1}});
+  a.erase(a.begin(), a.begin() + static_cast<std::ptrdiff_t>(zeros));
+
+  const auto fits = [](std::uint64_t d) {
+    return d <= static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+  };
+  const auto numerators{divisors(magnitude(a.front()))};
+  const auto denominators{divisors(magnitude(a.back()))};
+  // a = (q x - p) b with integer b, so q - p divides a(1) and q + p a(-1)
+  wide at_one{0};
+  wide at_minus_one{0};
+  const auto evaluate_at_units = [&] {
+    at_one = 0;
+    at_minus_one = 0;
+    for (std::size_t i = a.size(); i > 0; --i) {
+      at_one += a[i - 1];
+      at_minus_one = a[i - 1] - at_minus_one;
+    }
+  };
+  const auto passes_units = [&](wide p, wide q) {
+    return (at_one == 0 || (q != p && at_one % (q - p) == 0)) &&
+           (at_minus_one == 0 || (q != -p && at_minus_one % (q + p) == 0));
+  };
+  evaluate_at_units();
+  std::vector<std::pair<T, T>> block{};
+  const auto flush = [&] {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+      ((block.empty() ? void() : prune<primes[I]>(a, block)), ...);
+    }(std::make_index_sequence<std::size(primes)>{});
+    for (const auto &[p, q] : block) {
+      while (a.size() > 1 && a.front() % p == 0 && a.back() % q == 0 &&
+             deflate(a, p, q)) {
+        roots.emplace_back(p, q);
+      }
+    }
+    block.clear();
+    evaluate_at_units();
+  };
+  for (const std::uint64_t q : denominators) {
+    for (const std::uint64_t p : numerators) {
+      if (a.size() == 1) {
+        break;
+      }
+      if (!fits(p) || !fits(q) || std::gcd(p, q) != 1 ||
+          magnitude(a.front()) % p != 0 || magnitude(a.back()) % q != 0) {
+        continue;
+      }
+      for (const T numerator : {static_cast<T>(p), -static_cast<T>(p)}) {
+        if (passes_units(numerator, static_cast<T>(q))) {
+          block.emplace_back(numerator, static_cast<T>(q));
+        }
+      }
+      if (block.size() >= block_size) {
+        flush();
+      }
+    }
+  }
+  if (a.size() > 1) {
+    flush();
+  }
+  std::ranges::sort(roots, [](const auto &x, const auto &y) {
+    return wide{x.first} * y.second < wide{y.first} * x.second;
+  });
+  return roots;
+}
+}  // namespace rational_root_search
 template <typename T>
 struct polynomial {
  public:
@@ -45,16 +1319,9 @@ struct polynomial {
   }
   
   auto operator*=(const polynomial &p) -> polynomial & {
-    std::vector<T> multiplication_vector{};
-    multiplication_vector.resize(p.degree + degree + 1, T{0});
-    coefficients.resize(p.degree + degree + 1, T{0});
-    for (std::size_t i = degree + 1; i > 0; i--) {
-      for (std::size_t j = p.degree + 1; j > 0; j--) {
-        multiplication_vector[i + j - 2] +=
-            coefficients[i - 1] * p.coefficients[j - 1];
-      }
-    }
-    coefficients = multiplication_vector;
+    coefficients = multiplication::multiply(
+        std::span<const T>{coefficients.data(), degree + 1},
+        std::span<const T>{p.coefficients.data(), p.degree + 1});
     degree += p.degree;
     return *this;
   }
@@ -65,6 +1332,17 @@ struct polynomial {
     } else if (p.degree > degree) {
       throw std::invalid_argument("Division by invalid polynomial");
     }
+    if constexpr (is_modular_v<T>) {
+      auto quotient{division::divide(
+                        std::span<const T>{coefficients.data(), degree + 1},
+                        std::span<const T>{p.coefficients.data(),
+                                           p.degree + 1})
+                        .first};
+      quotient.resize(degree - p.degree + 1, T{0});
+      coefficients = std::move(quotient);
+      degree -= p.degree;
+      return *this;
+    }
     std::vector<T> division_vector{};
     division_vector.resize(degree - p.degree + 1, T{0});
     for (std::size_t i = degree; i > p.degree - 1; i--) {
@@ -87,6 +1365,19 @@ struct polynomial {
     if (p.degree == 0 && p.coefficients[0] == T{0}) {
       throw std::invalid_argument("Division by zero polynomial");
     }
+    if constexpr (is_modular_v<T>) {
+      auto remainder{division::divide(
+                         std::span<const T>{coefficients.data(), degree + 1},
+                         std::span<const T>{p.coefficients.data(),
+                                            p.degree + 1})
+                         .second};
+      if (remainder.empty()) {
+        remainder.push_back(T{0});
+      }
+      degree = remainder.size() - 1;
+      coefficients = std::move(remainder);
+      return *this;
+    }
     polynomial quotient;
     polynomial remainder = *this;
     quotient = *this / p;
@@ -97,12 +1388,46 @@ struct polynomial {
 
  public:
   auto operator()(T value) {
+    if (degree + 1 >= evaluation::estrin_threshold) {
+      return evaluation::estrin(
+          std::span<const T>{coefficients.data(), degree + 1}, value);
+    }
     T result = 0;
     for (int i = this->degree; i >= 0; --i) {
       result = result * value + this->coefficients[i];
     }
     return result;
   }
+  /*
+      description:
+          Evaluates the polynomial at every point of a batch, see namespace
+     evaluation.
+      parameters:
+          points - the values at which to evaluate the polynomial
+          results - receives the value at points[i] at index i
+  */
+  auto evaluate(std::span<const T> points, std::span<T> results) const
+      -> void {
+    if (points.size() != results.size()) {
+      throw std::invalid_argument("Results must be as long as points");
+    }
+    evaluation::evaluate(
+        std::span<const T>{coefficients.data(), degree + 1}, points,
+        results);
+  }
+  /*
+      description:
+          Evaluates the polynomial at every point of a batch.
+      parameters:
+          points - the values at which to evaluate the polynomial
+      return:
+          std::vector<T> - the value at points[i] at index i
+  */
+  auto evaluate(std::span<const T> points) const -> std::vector<T> {
+    std::vector<T> results(points.size());
+    evaluate(points, std::span<T>{results});
+    return results;
+  }
 };
 
 template <typename T>
@@ -160,6 +1485,26 @@ inline auto root_rational_candidates(polynomial<T> p) -> std::set<T> {
   }
   return factors;
 }
+/*
+    description:
+        Finds the rational roots of a polynomial with integer coefficients.
+   The extreme coefficients are factored, the candidates are pruned by
+   batched evaluation modulo a few primes and the survivors are divided out
+   exactly one by one, see rational_root_search.
+    parameters:
+        p - the polynomial
+    return:
+        std::vector<std::pair<T, T>> - the roots as numerator and positive
+   denominator in lowest terms, in increasing order and repeated by
+   multiplicity
+*/
+template <std::signed_integral T>
+inline auto rational_roots(const polynomial<T> &p)
+    -> std::vector<std::pair<T, T>> {
+  return rational_root_search::find(std::vector<T>(
+      p.coefficients.begin(),
+      p.coefficients.begin() + static_cast<std::ptrdiff_t>(p.degree + 1)));
+}
 
 template <typename T>
 auto gcd(polynomial<T> p, polynomial<T> q)
@@ -174,6 +1519,44 @@ auto gcd(polynomial<T> p, polynomial<T> q)
   return {p, steps};
 }
 
+/*
+    description:
+        Computes the greatest common divisor without coefficient growth. For
+   modular coefficients it uses the half-gcd algorithm and the result is
+   monic, for integer coefficients it uses the multi-prime algorithm and the
+   result has a positive leading coefficient and the gcd of the contents as
+   its content.
+    parameters:
+        p - the first polynomial
+        q - the second polynomial
+    return:
+        polynomial<T> - the gcd
+*/
+template <typename T>
+  requires(is_modular_v<T> || std::integral<T>)
+inline auto fast_gcd(const polynomial<T> &p, const polynomial<T> &q)
+    -> polynomial<T> {
+  std::vector<T> a(p.coefficients.begin(),
+                   p.coefficients.begin() +
+                       static_cast<std::ptrdiff_t>(p.degree + 1));
+  std::vector<T> b(q.coefficients.begin(),
+                   q.coefficients.begin() +
+                       static_cast<std::ptrdiff_t>(q.degree + 1));
+  division::trim(a);
+  division::trim(b);
+  std::vector<T> result{};
+  if constexpr (is_modular_v<T>) {
+    result = half_gcd::gcd(std::move(a), std::move(b));
+  } else {
+    result = modular_gcd::gcd(std::move(a), std::move(b));
+  }
+  if (result.empty()) {
+    return {{T{0}}, 0};
+  }
+  const std::size_t degree{result.size() - 1};
+  return {std::move(result), degree};
+}
+
 template <typename T>
 std::ostream &operator<<(std::ostream &os, const polynomial<T> &p) {
   for (std::size_t i = p.degree; i > 0; --i) {
@@ -183,6 +1566,18 @@ std::ostream &operator<<(std::ostream &os, const polynomial<T> &p) {
   return os;
 }
 }
+/*
+    description:
+        Formats a modular coefficient as its representative in [0, mod).
+*/
+template <std::uint32_t mod>
+struct std::formatter<polynomial::modular<mod>>
+    : std::formatter<std::uint32_t> {
+  auto format(const polynomial::modular<mod> &x,
+              std::format_context &ctx) const {
+    return std::formatter<std::uint32_t>::format(x.value, ctx);
+  }
+};
 
 template <typename T>
 void performoperation(const polynomial::polynomial<T> &p1,
@@ -4,8 +4,10 @@
 #include <cstdint>
 #include <format>
 #include <iostream>
+#include <limits>
 #include <print>
 #include <set>
+#include <stdexcept>
 #include <vector>
 
 import recursion;
@@ -96,12 +98,161 @@ auto test_sorts() -> bool {
 }
 
 
+auto test_queens() -> bool {
+    const auto solutions{queens_solutions(6)};
+
+    return testing::expect_equal(count_queens(8), 92) &&
+           testing::expect_equal(count_queens(11), 2680) &&
+           testing::expect_equal(count_queens(3), 0) &&
+           testing::expect_equal(solutions.size(), 4) &&
+           testing::expect_equal(solutions.front(),
+                                 std::vector{1, 3, 5, 0, 2, 4}) &&
+           testing::expect_equal(queens_solutions(9).size(), 352);
+}
+
+
+auto test_lazy() -> bool {
+    std::vector<std::string> sequences;
+    for (const auto sequence :
+         lazy_sequences_from_a_set(std::set<char>{'a', 'b', 'c'}, 2)) {
+        sequences.emplace_back(sequence);
+    }
+    std::vector<std::string> bits;
+    for (const auto representation : lazy_more_ones(8)) {
+        bits.emplace_back(representation);
+    }
+    std::vector<int> representations;
+    for (const int number : lazy_increasing_representations(2)) {
+        representations.push_back(number);
+    }
+    std::vector<std::vector<std::size_t>> decompositions;
+    for (const auto decomposition : lazy_non_increasing_decompositions(6)) {
+        decompositions.emplace_back(decomposition.begin(), decomposition.end());
+    }
+    std::set<std::vector<std::int32_t>> subsets_found;
+    for (const auto subset : lazy_subsets({1, 2, 3, 4})) {
+        std::vector<std::int32_t> sorted(subset.begin(), subset.end());
+        std::ranges::sort(sorted);
+        subsets_found.insert(sorted);
+    }
+    const auto expected_subsets{subsets({1, 2, 3, 4})};
+    std::set<std::int32_t> too_many;
+    for (std::int32_t i = 0; i < 64; ++i) { too_many.insert(i); }
+    bool rejected{false};
+    try {
+        lazy_subsets(too_many);
+    } catch (const std::length_error&) {
+        rejected = true;
+    }
+
+    return testing::expect_equal(
+               sequences,
+               sequences_from_a_set(std::set<char>{'a', 'b', 'c'}, 2)) &&
+           testing::expect_equal(bits, more_ones(8)) &&
+           testing::expect_equal(representations,
+                                 increasing_representations(2)) &&
+           testing::expect_equal(decompositions,
+                                 non_increasing_decompositions(6)) &&
+           testing::expect_equal(subsets_found.size(), 15) &&
+           testing::expect_equal(rejected, true) &&
+           testing::expect_equal(
+               subsets_found,
+               std::set<std::vector<std::int32_t>>(expected_subsets.begin(),
+                                                   expected_subsets.end()));
+}
+
+
+// shortest distances from (0, 0) by a plain breadth-first search, the
+// reference for the lengths of shortest_path_in_maze
+auto maze_distances(const std::vector<bool>& maze,
+                    std::size_t rows,
+                    std::size_t columns) -> std::vector<std::size_t> {
+    constexpr std::size_t unreached = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> distances(maze.size(), unreached);
+    std::vector<std::size_t> queue{0};
+    distances[0] = 0;
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        const std::size_t x = queue[head] / columns;
+        const std::size_t y = queue[head] % columns;
+        const std::array<std::pair<std::size_t, std::size_t>, 4> moves{
+            {{x + 1, y}, {x - 1, y}, {x, y + 1}, {x, y - 1}}};
+        for (const auto& [next_x, next_y] : moves) {
+            if (next_x >= rows || next_y >= columns) { continue; }
+            const std::size_t next = next_x * columns + next_y;
+            if (maze[next] || distances[next] != unreached) { continue; }
+            distances[next] = distances[queue[head]] + 1;
+            queue.push_back(next);
+        }
+    }
+    return distances;
+}
+
+
+// 130 columns take three 64-bit words per row. Walls every 7 columns leave a
+// gap alternately in the bottom and the top row, so the path snakes through
+// the columns 63 | 64 and 127 | 128 where the words meet
+auto test_wide_maze() -> bool {
+    constexpr std::size_t rows = 9;
+    constexpr std::size_t columns = 130;
+    std::vector<bool> maze(rows * columns, false);
+    for (std::size_t y = 3; y < columns; y += 7) {
+        const std::size_t gap = (y / 7) % 2 == 0 ? rows - 1 : 0;
+        for (std::size_t x = 0; x < rows; ++x) {
+            maze[x * columns + y] = x != gap;
+        }
+    }
+    const int end_x = rows - 1;
+    const int end_y = columns - 1;
+    const auto path =
+        shortest_path_in_maze(maze, rows, columns, 0, 0, end_x, end_y);
+    bool connected =
+        !path.empty() && path.front() == std::pair<std::size_t, std::size_t>{0, 0} &&
+        path.back() == std::pair<std::size_t, std::size_t>{rows - 1, columns - 1};
+    for (std::size_t i = 1; i < path.size(); ++i) {
+        const auto [x, y] = path[i - 1];
+        const auto [next_x, next_y] = path[i];
+        const std::size_t step = (x > next_x ? x - next_x : next_x - x) +
+                                 (y > next_y ? y - next_y : next_y - y);
+        connected = connected && step == 1 && !maze[next_x * columns + next_y];
+    }
+
+    // closing the gap of the wall in column 66 cuts the maze in two
+    std::vector<bool> closed = maze;
+    closed[66] = true;
+    return testing::expect_equal(
+               path_in_maze_bfs(maze, rows, columns, 0, 0, end_x, end_y), true) &&
+           testing::expect_equal(path.size() - 1,
+                                 maze_distances(maze, rows, columns).back()) &&
+           testing::expect_equal(connected, true) &&
+           testing::expect_equal(
+               path_in_maze_bfs(closed, rows, columns, 0, 0, end_x, end_y),
+               false) &&
+           testing::expect_equal(
+               shortest_path_in_maze(closed, rows, columns, 0, 0, end_x, end_y)
+                   .size(),
+               0);
+}
+
+
 auto test_maze() -> bool {
     std::vector<bool> maze = {
         0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0,
         0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0,
     };
-    return testing::expect_equal(path_in_maze(maze, 5, 5, 0, 0, 4, 4), true);
+    const auto path = shortest_path_in_maze(maze, 5, 5, 0, 0, 4, 4);
+    std::vector<bool> walled = maze;
+    walled[13] = true;
+    walled[14] = true;
+    return testing::expect_equal(path_in_maze(maze, 5, 5, 0, 0, 4, 4), true) &&
+           testing::expect_equal(path_in_maze_bfs(maze, 5, 5, 0, 0, 4, 4),
+                                 true) &&
+           testing::expect_equal(path.size(), 9) &&
+           testing::expect_equal(path.front().first + path.front().second, 0) &&
+           testing::expect_equal(path.back().first + path.back().second, 8) &&
+           testing::expect_equal(path_in_maze_bfs(walled, 5, 5, 0, 0, 4, 4),
+                                 false) &&
+           testing::expect_equal(
+               shortest_path_in_maze(walled, 5, 5, 0, 0, 4, 4).size(), 0);
 }
 
 
@@ -115,7 +266,10 @@ int main() {
                                           recursion_tests(),
                                           test_vectors(),
                                           test_sorts(),
-                                          test_maze()},
+                                          test_maze(),
+                                          test_wide_maze(),
+                                          test_queens(),
+                                          test_lazy()},
                                std::identity{})
                ? 0
                : 1;